@@ -0,0 +1,94 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <cstdint>
+
+#include <ddc/ddc.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <Kokkos_Core.hpp>
+
+inline namespace anonymous_namespace_workaround_parallel_transform_reduce_cpp {
+
+struct DDimX
+{
+};
+
+struct DDimY
+{
+};
+
+template <class Reducer>
+void benchmark_ddc_parallel_transform_reduce(benchmark::State& state)
+{
+    ddc::DiscreteDomain<DDimX> const domain_x
+            = ddc::init_trivial_bounded_space(ddc::DiscreteVector<DDimX>(state.range(0)));
+    ddc::DiscreteDomain<DDimY> const domain_y
+            = ddc::init_trivial_bounded_space(ddc::DiscreteVector<DDimY>(state.range(0)));
+
+    ddc::DiscreteDomain<DDimX, DDimY> const ddom_xy(domain_x, domain_y);
+    ddc::Chunk chk("chk", ddom_xy, ddc::DeviceAllocator<double>());
+    ddc::ChunkSpan const chk_span = chk.span_view();
+    Kokkos::DefaultExecutionSpace const exec_space;
+    ddc::parallel_for_each(
+            exec_space,
+            ddom_xy,
+            KOKKOS_LAMBDA(ddc::DiscreteElement<DDimX, DDimY> const ixy) {
+                chk_span(ixy) = Kokkos::sin(
+                        static_cast<double>(ddc::DiscreteElement<DDimX>(ixy).uid())
+                        + 0.3 * static_cast<double>(ddc::DiscreteElement<DDimY>(ixy).uid()));
+            });
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ddc::parallel_transform_reduce(
+                exec_space,
+                ddom_xy,
+                0.,
+                Reducer(),
+                chk_span.span_cview()));
+    }
+    state.SetBytesProcessed(
+            static_cast<std::int64_t>(state.iterations())
+            * static_cast<std::int64_t>(chk_span.size() * sizeof(double)));
+}
+
+std::size_t constexpr small_dim1_2D = 32;
+std::size_t constexpr large_dim1_2D = 4'000;
+
+} // namespace anonymous_namespace_workaround_parallel_transform_reduce_cpp
+
+// NOLINTBEGIN(misc-use-anonymous-namespace)
+BENCHMARK(benchmark_ddc_parallel_transform_reduce<ddc::reducer::sum<double>>)
+        ->Name("benchmark_ddc_parallel_transform_reduce_sum_small")
+        ->Arg(small_dim1_2D);
+BENCHMARK(benchmark_ddc_parallel_transform_reduce<ddc::reducer::reproducible_sum<double>>)
+        ->Name("benchmark_ddc_parallel_transform_reduce_reproducible_sum_small")
+        ->Arg(small_dim1_2D);
+
+BENCHMARK(benchmark_ddc_parallel_transform_reduce<ddc::reducer::sum<double>>)
+        ->Name("benchmark_ddc_parallel_transform_reduce_sum")
+        ->Arg(small_dim1_2D)
+        ->Arg(large_dim1_2D);
+BENCHMARK(benchmark_ddc_parallel_transform_reduce<ddc::reducer::reproducible_sum<double>>)
+        ->Name("benchmark_ddc_parallel_transform_reduce_reproducible_sum")
+        ->Arg(small_dim1_2D)
+        ->Arg(large_dim1_2D);
+// NOLINTEND(misc-use-anonymous-namespace)
+
+int main(int argc, char** argv)
+{
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    {
+        Kokkos::ScopeGuard const kokkos_scope(argc, argv);
+        ddc::ScopeGuard const ddc_scope(argc, argv);
+        ::benchmark::RunSpecifiedBenchmarks();
+    }
+    ::benchmark::Shutdown();
+    return 0;
+}
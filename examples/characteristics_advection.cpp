@@ -225,11 +225,11 @@ int main(int argc, char** argv)
             ddc::DeviceAllocator<double>());
     ddc::ChunkSpan const coef = coef_alloc.span_view();
 
-    // Instantiate chunk to receive feet coords
-    ddc::Chunk feet_coords_alloc(
-            spline_builder.batched_interpolation_domain(x_mesh),
-            ddc::DeviceAllocator<ddc::Coordinate<X>>());
-    ddc::ChunkSpan const feet_coords = feet_coords_alloc.span_view();
+    // The coordinates of the characteristics feet, computed on the fly by the evaluator
+    double const feet_shift = vx * ddc::step<DDimT>();
+    auto const feet_coords = KOKKOS_LAMBDA(ddc::DiscreteElement<DDimX, DDimY> const e) {
+        return ddc::coordinate(ddc::DiscreteElement<DDimX>(e)) - ddc::Coordinate<X>(feet_shift);
+    };
     //! [instantiate intermediate chunks]
 
 
@@ -247,16 +247,9 @@ int main(int argc, char** argv)
 
         //! [numerical scheme]
         // Stencil computation on the main domain
-        // Find the coordinates of the characteristics feet
-        ddc::parallel_for_each(
-                feet_coords.domain(),
-                KOKKOS_LAMBDA(ddc::DiscreteElement<DDimX, DDimY> const e) {
-                    feet_coords(e) = ddc::coordinate(ddc::DiscreteElement<DDimX>(e))
-                                     - ddc::Coordinate<X>(vx * ddc::step<DDimT>());
-                });
-        // Interpolate the values at feet on the grid
+        // Interpolate the values at the characteristics feet on the grid
         spline_builder(coef, last_density.span_cview());
-        spline_evaluator(next_density, feet_coords.span_cview(), coef.span_cview());
+        spline_evaluator(next_density, feet_coords, coef.span_cview());
         //! [numerical scheme]
 
         //! [output]
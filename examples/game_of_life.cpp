@@ -59,11 +59,10 @@ int main()
                       .remove(ddc::DiscreteVector<DDimX, DDimY>(1, 1),
                               ddc::DiscreteVector<DDimX, DDimY>(1, 1));
 
-    ddc::Chunk cells_in_dev_alloc("cells_in_dev", domain_xy, ddc::DeviceAllocator<cell>());
+    ddc::DualChunk<cell, ddc::DiscreteDomain<DDimX, DDimY>> cells_in_alloc("cells_in", domain_xy);
     ddc::Chunk cells_out_dev_alloc("cells_out_dev", domain_xy, ddc::DeviceAllocator<cell>());
-    ddc::Chunk cells_in_host_alloc = ddc::create_mirror(cells_in_dev_alloc.span_cview());
 
-    ddc::ChunkSpan const cells_in = cells_in_dev_alloc.span_view();
+    ddc::ChunkSpan const cells_in = cells_in_alloc.span_view<Kokkos::DefaultExecutionSpace>();
     ddc::ChunkSpan const cells_out = cells_out_dev_alloc.span_view();
 
     // Initialize the whole domain
@@ -72,8 +71,8 @@ int main()
 
     std::size_t iter = 0;
     for (; iter < nt; ++iter) {
-        ddc::parallel_deepcopy(cells_in_host_alloc, cells_in);
-        ddc::print_content(std::cout, cells_in_host_alloc.span_cview()) << '\n';
+        cells_in_alloc.sync<Kokkos::HostSpace>();
+        ddc::print_content(std::cout, cells_in_alloc.span_cview<Kokkos::HostSpace>()) << '\n';
         ddc::parallel_for_each(
                 inner_domain_xy,
                 KOKKOS_LAMBDA(ddc::DiscreteElement<DDimX, DDimY> const ixy) {
@@ -101,10 +100,14 @@ int main()
                         }
                     }
                 });
-        ddc::parallel_deepcopy(cells_in, cells_out);
+        // The whole domain is marked as modified so that the next sync is a single asynchronous
+        // copy, a partial region would go through temporary buffers
+        ddc::parallel_deepcopy(
+                cells_in_alloc.span_view<Kokkos::DefaultExecutionSpace>(),
+                cells_out);
     }
-    ddc::parallel_deepcopy(cells_in_host_alloc, cells_in);
-    ddc::print_content(std::cout, cells_in_host_alloc.span_cview()) << '\n';
+    cells_in_alloc.sync<Kokkos::HostSpace>();
+    ddc::print_content(std::cout, cells_in_alloc.span_cview<Kokkos::HostSpace>()) << '\n';
 
     return 0;
 }
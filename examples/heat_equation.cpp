@@ -132,17 +132,6 @@ int main(int argc, char** argv)
                     gwx));
     //! [X-global-domain]
 
-    //! [X-domains]
-    // our zone at the start of the domain that will be mirrored to the
-    // ghost
-    ddc::DiscreteDomain<DDimX> const
-            x_post_mirror(x_post_ghost.front() - x_domain.extents(), x_post_ghost.extents());
-    // our zone at the end of the domain that will be mirrored to the
-    // ghost
-    ddc::DiscreteDomain<DDimX> const
-            x_pre_mirror(x_pre_ghost.front() + x_domain.extents(), x_pre_ghost.extents());
-    //! [X-domains]
-
     //! [Y-domains]
     // Number of ghost points to use on each side in Y
     ddc::DiscreteVector<DDimY> static constexpr gwy(1);
@@ -155,15 +144,6 @@ int main(int argc, char** argv)
                     ddc::Coordinate<Y>(y_end),
                     ddc::DiscreteVector<DDimY>(nb_y_points),
                     gwy));
-
-    // our zone at the start of the domain that will be mirrored to the
-    // ghost
-    ddc::DiscreteDomain<DDimY> const
-            y_post_mirror(y_post_ghost.front() - y_domain.extents(), y_post_ghost.extents());
-    // our zone at the end of the domain that will be mirrored to the
-    // ghost
-    ddc::DiscreteDomain<DDimY> const
-            y_pre_mirror(y_pre_ghost.front() + y_domain.extents(), y_pre_ghost.extents());
     //! [Y-domains]
 
     //! [time-domains]
@@ -245,27 +225,13 @@ int main(int argc, char** argv)
         //! [time iteration]
 
         //! [boundary conditions]
-        // Periodic boundary conditions
-        for (ddc::DiscreteVectorElement ix = 0; ix < x_pre_ghost.extents().value(); ++ix) {
-            ddc::parallel_deepcopy(
-                    ghosted_last_temp[x_pre_ghost[ix]][y_domain],
-                    ghosted_last_temp[x_pre_mirror[ix]][y_domain]);
-        }
-        for (ddc::DiscreteVectorElement ix = 0; ix < x_post_ghost.extents().value(); ++ix) {
-            ddc::parallel_deepcopy(
-                    ghosted_last_temp[x_post_ghost[ix]][y_domain],
-                    ghosted_last_temp[x_post_mirror[ix]][y_domain]);
-        }
-        for (ddc::DiscreteVectorElement iy = 0; iy < y_pre_ghost.extents().value(); ++iy) {
-            ddc::parallel_deepcopy(
-                    ghosted_last_temp[x_domain][y_pre_ghost[iy]],
-                    ghosted_last_temp[x_domain][y_pre_mirror[iy]]);
-        }
-        for (ddc::DiscreteVectorElement iy = 0; iy < y_post_ghost.extents().value(); ++iy) {
-            ddc::parallel_deepcopy(
-                    ghosted_last_temp[x_domain][y_post_ghost[iy]],
-                    ghosted_last_temp[x_domain][y_post_mirror[iy]]);
-        }
+        // Periodic boundary conditions, all the ghosts are filled in a single kernel
+        ddc::fill_ghosts(
+                ghosted_last_temp,
+                ddc::DiscreteDomain<DDimX, DDimY>(ghosted_x_domain, ghosted_y_domain),
+                ddc::DiscreteDomain<DDimX, DDimY>(x_domain, y_domain),
+                ddc::PeriodicGhosts(),
+                ddc::PeriodicGhosts());
         //! [boundary conditions]
 
         //! [manipulated views]
@@ -278,29 +244,30 @@ int main(int argc, char** argv)
         //! [manipulated views]
 
         //! [numerical scheme]
-        // Stencil computation on the main domain
-        ddc::parallel_for_each(
-                next_temp.domain(),
-                KOKKOS_LAMBDA(ddc::DiscreteElement<DDimX, DDimY> const ixy) {
-                    ddc::DiscreteElement<DDimX> const ix(ixy);
-                    ddc::DiscreteElement<DDimY> const iy(ixy);
+        // Stencil computation on the main domain, `temp` gives access to the neighbours of the
+        // point at a distance of at most one point in each direction
+        ddc::parallel_stencil(
+                next_temp,
+                last_temp,
+                ddc::DiscreteVector<DDimX, DDimY>(1, 1),
+                KOKKOS_LAMBDA(auto const& temp) {
+                    ddc::DiscreteElement<DDimX> const ix(temp.element());
+                    ddc::DiscreteElement<DDimY> const iy(temp.element());
                     double const dx_l = ddc::distance_at_left(ix);
                     double const dx_r = ddc::distance_at_right(ix);
                     double const dx_m = 0.5 * (dx_l + dx_r);
                     double const dy_l = ddc::distance_at_left(iy);
                     double const dy_r = ddc::distance_at_right(iy);
                     double const dy_m = 0.5 * (dy_l + dy_r);
-                    next_temp(ix, iy) = last_temp(ix, iy);
-                    next_temp(ix, iy)
-                            += kx * ddc::step<DDimT>()
-                               * (dx_l * last_temp(ix + 1, iy) - 2.0 * dx_m * last_temp(ix, iy)
-                                  + dx_r * last_temp(ix - 1, iy))
-                               / (dx_l * dx_m * dx_r);
-                    next_temp(ix, iy)
-                            += ky * ddc::step<DDimT>()
-                               * (dy_l * last_temp(ix, iy + 1) - 2.0 * dy_m * last_temp(ix, iy)
-                                  + dy_r * last_temp(ix, iy - 1))
-                               / (dy_l * dy_m * dy_r);
+                    ddc::DiscreteVector<DDimX> const dx(1);
+                    ddc::DiscreteVector<DDimY> const dy(1);
+                    return temp()
+                           + kx * ddc::step<DDimT>()
+                                     * (dx_l * temp(dx) - 2.0 * dx_m * temp() + dx_r * temp(-dx))
+                                     / (dx_l * dx_m * dx_r)
+                           + ky * ddc::step<DDimT>()
+                                     * (dy_l * temp(dy) - 2.0 * dy_m * temp() + dy_r * temp(-dy))
+                                     / (dy_l * dy_m * dy_r);
                 });
         //! [numerical scheme]
 
@@ -316,17 +316,20 @@ int main(int argc, char** argv)
         //! [manipulated views]
 
         //! [numerical scheme]
+        // the spacings of the meshes are precomputed, the metrics are captured by value
+        ddc::MeshMetrics<DDimX> const x_metrics = ddc::mesh_metrics<DDimX>();
+        ddc::MeshMetrics<DDimY> const y_metrics = ddc::mesh_metrics<DDimY>();
         ddc::parallel_for_each(
                 next_temp.domain(),
                 KOKKOS_LAMBDA(ddc::DiscreteElement<DDimX, DDimY> const ixy) {
                     ddc::DiscreteElement<DDimX> const ix(ixy);
                     ddc::DiscreteElement<DDimY> const iy(ixy);
-                    double const dx_l = ddc::distance_at_left(ix);
-                    double const dx_r = ddc::distance_at_right(ix);
-                    double const dx_m = 0.5 * (dx_l + dx_r);
-                    double const dy_l = ddc::distance_at_left(iy);
-                    double const dy_r = ddc::distance_at_right(iy);
-                    double const dy_m = 0.5 * (dy_l + dy_r);
+                    double const dx_l = x_metrics.distance_at_left(ix);
+                    double const dx_r = x_metrics.distance_at_right(ix);
+                    double const dx_m = x_metrics.cell_width(ix);
+                    double const dy_l = y_metrics.distance_at_left(iy);
+                    double const dy_r = y_metrics.distance_at_right(iy);
+                    double const dy_m = y_metrics.cell_width(iy);
                     next_temp(ix, iy) = last_temp(ix, iy);
                     next_temp(ix, iy)
                             += kx * ddc::step<DDimT>()
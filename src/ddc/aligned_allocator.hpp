@@ -6,8 +6,13 @@
 
 #include <cstddef>
 #include <new>
+#include <string>
 #include <type_traits>
 
+#include <Kokkos_Core.hpp>
+
+#include "memory_accounting.hpp"
+
 namespace ddc {
 
 template <class T, std::size_t N>
@@ -16,6 +21,8 @@ class AlignedAllocator
 public:
     using value_type = T;
 
+    using memory_space = Kokkos::HostSpace;
+
     template <class U>
     struct rebind
     {
@@ -46,11 +53,20 @@ public:
 
     [[nodiscard]] T* allocate(std::size_t n) const
     {
-        return new (std::align_val_t(N)) value_type[n];
+        return allocate("", n);
+    }
+
+    /// The label is provided for compatibility with `Chunk`, only the memory accounting uses it
+    [[nodiscard]] T* allocate(std::string const& label, std::size_t n) const
+    {
+        T* const ptr = new (std::align_val_t(N)) value_type[n];
+        detail::record_allocation(ptr, memory_space::name(), label, sizeof(T) * n);
+        return ptr;
     }
 
     void deallocate(T* p, std::size_t) const
     {
+        detail::record_deallocation(p);
         operator delete[](p, std::align_val_t(N));
     }
 };
@@ -4,8 +4,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include <Kokkos_Core.hpp>
@@ -21,6 +24,27 @@
 
 namespace ddc {
 
+/// Growth policy of `Chunk::reset_domain` allocating exactly the required storage
+struct ExactGrowth
+{
+    std::size_t operator()(std::size_t /*capacity*/, std::size_t required) const noexcept
+    {
+        return required;
+    }
+};
+
+/// Growth policy of `Chunk::reset_domain` multiplying the capacity by a factor, amortizing the
+/// reallocations of steadily growing domains
+struct GeometricGrowth
+{
+    double factor = 2.;
+
+    std::size_t operator()(std::size_t capacity, std::size_t required) const noexcept
+    {
+        return std::max(required, static_cast<std::size_t>(static_cast<double>(capacity) * factor));
+    }
+};
+
 template <class ElementType, class, class Allocator = HostAllocator<ElementType>>
 class Chunk;
 
@@ -28,24 +52,24 @@ template <class ElementType, class SupportType, class Allocator>
 inline constexpr bool enable_chunk<Chunk<ElementType, SupportType, Allocator>> = true;
 
 template <class ElementType, class SupportType, class Allocator>
-class Chunk : public ChunkCommon<ElementType, SupportType, Kokkos::layout_right>
+class Chunk : public ChunkCommon<ElementType, SupportType, detail::chunk_layout_t<Allocator>>
 {
 protected:
-    using base_type = ChunkCommon<ElementType, SupportType, Kokkos::layout_right>;
+    using base_type = ChunkCommon<ElementType, SupportType, detail::chunk_layout_t<Allocator>>;
 
 public:
     /// type of a span of this full chunk
     using span_type = ChunkSpan<
             ElementType,
             SupportType,
-            Kokkos::layout_right,
+            detail::chunk_layout_t<Allocator>,
             typename Allocator::memory_space>;
 
     /// type of a view of this full chunk
     using view_type = ChunkSpan<
             ElementType const,
             SupportType,
-            Kokkos::layout_right,
+            detail::chunk_layout_t<Allocator>,
             typename Allocator::memory_space>;
 
     /// The dereferenceable part of the co-domain but with indexing starting at 0
@@ -85,6 +109,56 @@ private:
 
     std::string m_label;
 
+    /// number of elements of the allocation, can exceed the storage required by the domain
+    std::size_t m_capacity = 0;
+
+    /// Builds the mapping of the storage of the chunk, an allocator providing its own layout
+    /// also provides the mapping
+    static mapping_type make_mapping(SupportType const& domain)
+    {
+        extents_type const extents(detail::array(domain.extents()));
+        if constexpr (requires { Allocator::mapping(extents); }) {
+            return Allocator::mapping(extents);
+        } else {
+            return mapping_type(extents);
+        }
+    }
+
+    /** Allocates the storage of the chunk, an allocator may also take the domain to initialize
+     * the storage consistently with the loops over this domain
+     * @param allocator the allocator
+     * @param label the label of the chunk
+     * @param domain the domain of the chunk
+     * @return a mdspan on the allocation
+     */
+    static allocation_mdspan_type make_allocation_mdspan(
+            Allocator const& allocator,
+            std::string const& label,
+            SupportType const& domain)
+    {
+        mapping_type const mapping = make_mapping(domain);
+        if constexpr (
+                std::is_same_v<layout_type, Kokkos::layout_right>
+                && requires { allocator.allocate(label, domain); }) {
+            return allocation_mdspan_type(allocator.allocate(label, domain), mapping);
+        } else {
+            return allocation_mdspan_type(
+                    allocator.allocate(label, mapping.required_span_size()),
+                    mapping);
+        }
+    }
+
+    /// Releases the storage of the chunk, the label is given back to the allocators taking one
+    void deallocate() noexcept
+    {
+        std::size_t const n = m_capacity;
+        if constexpr (requires { m_allocator.deallocate(m_label, this->data_handle(), n); }) {
+            m_allocator.deallocate(m_label, this->data_handle(), n);
+        } else {
+            m_allocator.deallocate(this->data_handle(), n);
+        }
+    }
+
 public:
     /// Empty Chunk
     Chunk() = default;
@@ -94,9 +168,10 @@ public:
             std::string const& label,
             SupportType const& domain,
             Allocator allocator = Allocator())
-        : base_type(allocator.allocate(label, domain.size()), domain)
+        : base_type(make_allocation_mdspan(allocator, label, domain), domain)
         , m_allocator(std::move(allocator))
         , m_label(label)
+        , m_capacity(this->m_allocation_mdspan.mapping().required_span_size())
     {
     }
 
@@ -116,6 +191,7 @@ public:
         : base_type(std::move(static_cast<base_type&>(other)))
         , m_allocator(std::move(other.m_allocator))
         , m_label(std::move(other.m_label))
+        , m_capacity(std::exchange(other.m_capacity, 0))
     {
         other.m_allocation_mdspan
                 = allocation_mdspan_type(nullptr, other.m_allocation_mdspan.mapping());
@@ -124,7 +200,7 @@ public:
     ~Chunk() noexcept
     {
         if (this->m_allocation_mdspan.data_handle()) {
-            m_allocator.deallocate(this->data_handle(), this->size());
+            deallocate();
         }
     }
 
@@ -138,17 +214,61 @@ public:
     Chunk& operator=(Chunk&& other) noexcept
     {
         if (this->data_handle()) {
-            m_allocator.deallocate(this->data_handle(), this->size());
+            deallocate();
         }
         static_cast<base_type&>(*this) = std::move(static_cast<base_type&>(other));
         m_allocator = std::move(other.m_allocator);
         m_label = std::move(other.m_label);
+        m_capacity = std::exchange(other.m_capacity, 0);
         other.m_allocation_mdspan
                 = allocation_mdspan_type(nullptr, other.m_allocation_mdspan.mapping());
 
         return *this;
     }
 
+    /** Number of elements the allocation can hold without reallocating
+     * @return the capacity of the chunk
+     */
+    std::size_t capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+    /** Rebinds the chunk to a new domain, the values are left uninitialized
+     *
+     * The allocation is reused when it can hold the storage of `domain`, otherwise it is
+     * released and a new one of `growth(capacity(), required)` elements is made. The label and
+     * the allocator are kept.
+     * @param domain the new domain of the chunk
+     * @param growth the growth policy, a callable returning the new capacity from the current
+     *        one and the required one
+     */
+    template <class GrowthPolicy = ExactGrowth>
+    void reset_domain(SupportType const& domain, GrowthPolicy const& growth = GrowthPolicy())
+    {
+        mapping_type const mapping = make_mapping(domain);
+        std::size_t const required = mapping.required_span_size();
+        if (required > m_capacity) {
+            std::size_t const capacity = growth(m_capacity, required);
+            assert(capacity >= required);
+            if (this->data_handle()) {
+                deallocate();
+            }
+            this->m_allocation_mdspan = allocation_mdspan_type(nullptr, mapping);
+            m_capacity = 0;
+            if (capacity == required) {
+                this->m_allocation_mdspan = make_allocation_mdspan(m_allocator, m_label, domain);
+            } else {
+                this->m_allocation_mdspan
+                        = allocation_mdspan_type(m_allocator.allocate(m_label, capacity), mapping);
+            }
+            m_capacity = capacity;
+        } else {
+            this->m_allocation_mdspan = allocation_mdspan_type(this->data_handle(), mapping);
+        }
+        this->m_domain = domain;
+    }
+
     /// Slice out some dimensions
     template <class... QueryDDims>
     auto operator[](DiscreteVector<QueryDDims...> const& slice_spec) const
@@ -29,6 +29,28 @@ KOKKOS_FUNCTION auto get_domain(ChunkType const& chunk) noexcept
     return chunk.template domain<QueryDDims...>();
 }
 
+namespace detail {
+
+/// The extents of the chunks defined on a support, dynamic unless the support provides its own
+/// `static_extents_type`
+template <class SupportType>
+struct ChunkExtents
+{
+    using type = Kokkos::dextents<std::size_t, SupportType::rank()>;
+};
+
+template <class SupportType>
+    requires requires { typename SupportType::static_extents_type; }
+struct ChunkExtents<SupportType>
+{
+    using type = SupportType::static_extents_type;
+};
+
+template <class SupportType>
+using chunk_extents_t = ChunkExtents<SupportType>::type;
+
+} // namespace detail
+
 template <class ElementType, class SupportType, class LayoutStridedPolicy>
 class ChunkCommon
 {
@@ -38,12 +60,12 @@ public:
     /// The dereferenceable part of the co-domain but with a different domain, starting at 0
     using allocation_mdspan_type = Kokkos::mdspan<
             ElementType,
-            Kokkos::dextents<std::size_t, SupportType::rank()>,
+            detail::chunk_extents_t<SupportType>,
             LayoutStridedPolicy>;
 
     using const_allocation_mdspan_type = Kokkos::mdspan<
             ElementType const,
-            Kokkos::dextents<std::size_t, SupportType::rank()>,
+            detail::chunk_extents_t<SupportType>,
             LayoutStridedPolicy>;
 
     using discrete_element_type = discrete_domain_type::discrete_element_type;
@@ -21,6 +21,28 @@
 
 namespace ddc {
 
+namespace detail {
+
+/// The layout of the chunks built with an allocator, `layout_right` unless the allocator
+/// provides its own `layout_type`
+template <class Allocator>
+struct ChunkLayout
+{
+    using type = Kokkos::layout_right;
+};
+
+template <class Allocator>
+    requires requires { typename Allocator::layout_type; }
+struct ChunkLayout<Allocator>
+{
+    using type = Allocator::layout_type;
+};
+
+template <class Allocator>
+using chunk_layout_t = ChunkLayout<Allocator>::type;
+
+} // namespace detail
+
 template <class, class, class>
 class Chunk;
 
@@ -243,7 +265,9 @@ public:
     KOKKOS_FUNCTION constexpr ChunkSpan(KokkosView const& view, SupportType const& domain) noexcept
         requires(Kokkos::is_view_v<KokkosView>)
         : ChunkSpan(
-                  detail::build_mdspan(view, std::make_index_sequence<SupportType::rank()> {}),
+                  allocation_mdspan_type(detail::build_mdspan(
+                          view,
+                          std::make_index_sequence<SupportType::rank()> {})),
                   domain)
     {
     }
@@ -435,14 +459,14 @@ template <class ElementType, class SupportType, class Allocator>
 ChunkSpan(Chunk<ElementType, SupportType, Allocator>& other) -> ChunkSpan<
         ElementType,
         SupportType,
-        Kokkos::layout_right,
+        detail::chunk_layout_t<Allocator>,
         typename Allocator::memory_space>;
 
 template <class ElementType, class SupportType, class Allocator>
 ChunkSpan(Chunk<ElementType, SupportType, Allocator> const& other) -> ChunkSpan<
         ElementType const,
         SupportType,
-        Kokkos::layout_right,
+        detail::chunk_layout_t<Allocator>,
         typename Allocator::memory_space>;
 
 template <
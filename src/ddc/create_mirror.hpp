@@ -40,6 +40,8 @@ auto create_layout_right_view_and_copy(
 
 } // namespace detail
 
+/// `ddc::PinnedHostSpace()` can be given as `space` to all the `create_mirror*` functions to get a
+/// host mirror in page-locked memory, with faster transfers from and to the device.
 /// @param[in] space A Kokkos memory space or execution space.
 /// @param[in] src A layout right ChunkSpan.
 /// @return a `Chunk` with the same support and layout as `src` allocated on the `Space::memory_space` memory space.
@@ -54,7 +54,14 @@ namespace ddc {
 #include "chunk_common.hpp"
 #include "chunk_span.hpp"
 #include "chunk_traits.hpp"
+#include "dual_chunk.hpp"
+#include "first_touch_allocator.hpp"
+#include "huge_page_allocator.hpp"
 #include "kokkos_allocator.hpp"
+#include "local_chunk.hpp"
+#include "memory_accounting.hpp"
+#include "padded_allocator.hpp"
+#include "staging_buffer.hpp"
 
 // Discretizations
 #include "coordinate.hpp"
@@ -65,22 +72,29 @@ namespace ddc {
 #include "non_uniform_point_sampling.hpp"
 #include "periodic_sampling.hpp"
 #include "sparse_discrete_domain.hpp"
+#include "static_discrete_domain.hpp"
 #include "strided_discrete_domain.hpp"
 #include "trivial_space.hpp"
 #include "uniform_point_sampling.hpp"
 
 // Algorithms
 #include "create_mirror.hpp"
+#include "fill_ghosts.hpp"
 #include "for_each.hpp"
 #include "for_each_block.hpp"
+#include "parallel_checksum.hpp"
 #include "parallel_copy.hpp"
 #include "parallel_deepcopy.hpp"
 #include "parallel_fill.hpp"
 #include "parallel_for_each.hpp"
+#include "parallel_stencil.hpp"
 #include "parallel_transform.hpp"
 #include "parallel_transform_reduce.hpp"
 #include "parallel_transform_scan.hpp"
 #include "reducer.hpp"
+#include "team_for_each.hpp"
+#include "team_scan.hpp"
+#include "team_transform_reduce.hpp"
 #include "transform_reduce.hpp"
 
 // Output
@@ -0,0 +1,16 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+
+namespace ddc::detail {
+
+/// Number of elements processed in serial by each task of the parallel host algorithms. It does
+/// not depend on the number of threads so that the shape of a host reduction tree only depends
+/// on the size of the domain.
+inline constexpr std::size_t host_block_size = 4096;
+
+} // namespace ddc::detail
@@ -5,7 +5,9 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
+#include <limits>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -60,6 +62,40 @@ struct Rebind<DiscreteDomain<DDims...>, detail::TypeSeq<ODDims...>>
     using type = DiscreteDomain<ODDims...>;
 };
 
+inline constexpr std::uint64_t max_discrete_element_uid
+        = std::numeric_limits<DiscreteElementType>::max();
+
+inline constexpr std::uint64_t max_discrete_vector_element
+        = std::numeric_limits<DiscreteVectorElement>::max();
+
+/** Checks that the index types can represent a domain, this matters when DDC is built with
+ * 32-bit indices
+ * @param front the first element of the domain
+ * @param size the number of elements in each direction
+ * @return true if all the elements and the total number of elements are representable
+ */
+template <class... DDims>
+KOKKOS_FUNCTION constexpr bool is_representable_domain(
+        DiscreteElement<DDims...> const& front,
+        DiscreteVector<DDims...> const& size) noexcept
+{
+    std::uint64_t total = 1;
+    for (std::size_t i = 0; i < sizeof...(DDims); ++i) {
+        if (array(size)[i] < 0) {
+            return false;
+        }
+        std::uint64_t const n = array(size)[i];
+        if (n > max_discrete_element_uid - array(front)[i]) {
+            return false;
+        }
+        if (n != 0 && total > max_discrete_vector_element / n) {
+            return false;
+        }
+        total *= n;
+    }
+    return true;
+}
+
 } // namespace detail
 
 template <class... DDims>
@@ -82,6 +118,15 @@ private:
 
     DiscreteElement<DDims...> m_element_end;
 
+    /// The end of a domain, checked to be representable before it is computed
+    static KOKKOS_FUNCTION constexpr discrete_element_type representable_end(
+            discrete_element_type const& element_begin,
+            discrete_vector_type const& size)
+    {
+        KOKKOS_ASSERT(detail::is_representable_domain(element_begin, size))
+        return element_begin + size;
+    }
+
 public:
     static KOKKOS_FUNCTION constexpr std::size_t rank()
     {
@@ -94,7 +139,8 @@ public:
     template <concepts::discrete_domain... DDoms>
     KOKKOS_FUNCTION constexpr explicit DiscreteDomain(DDoms const&... domains)
         : m_element_begin(domains.front()...)
-        , m_element_end((domains.front() + domains.extents())...)
+        , m_element_end(
+                  representable_end(m_element_begin, discrete_vector_type(domains.extents()...)))
     {
     }
 
@@ -106,7 +152,7 @@ public:
             discrete_element_type const& element_begin,
             discrete_vector_type const& size)
         : m_element_begin(element_begin)
-        , m_element_end(element_begin + size)
+        , m_element_end(representable_end(element_begin, size))
     {
     }
 
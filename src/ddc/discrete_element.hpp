@@ -7,10 +7,13 @@
 #include <array>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <iosfwd>
 #include <type_traits>
 #include <utility>
 
+#include <ddc/config.hpp>
+
 #include <Kokkos_Macros.hpp>
 
 #include "detail/macros.hpp"
@@ -56,7 +59,11 @@ struct ToTypeSeq<DiscreteElement<Tags...>>
 
 /** A DiscreteCoordElement is a scalar that identifies an element of the discrete dimension
  */
+#if DDC_BUILD_32BIT_INDICES()
+using DiscreteElementType = std::uint32_t;
+#else
 using DiscreteElementType = std::size_t;
+#endif
 
 template <class Tag>
 KOKKOS_FUNCTION constexpr DiscreteElementType const& uid(DiscreteElement<Tag> const& tuple) noexcept
@@ -7,11 +7,14 @@
 #include <array>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <iosfwd>
 #include <span>
 #include <type_traits>
 #include <utility>
 
+#include <ddc/config.hpp>
+
 #include <Kokkos_Macros.hpp>
 
 #include "detail/macros.hpp"
@@ -55,7 +58,11 @@ struct ToTypeSeq<DiscreteVector<Tags...>>
 
 /** A DiscreteVectorElement is a scalar that represents the difference between two coordinates.
  */
+#if DDC_BUILD_32BIT_INDICES()
+using DiscreteVectorElement = std::int32_t;
+#else
 using DiscreteVectorElement = std::ptrdiff_t;
+#endif
 
 template <class QueryTag, class... Tags>
 KOKKOS_FUNCTION constexpr DiscreteVectorElement const& get(
@@ -0,0 +1,324 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include <Kokkos_Core.hpp>
+
+#include "chunk.hpp"
+#include "chunk_span.hpp"
+#include "create_mirror.hpp"
+#include "discrete_domain.hpp"
+#include "discrete_element.hpp"
+#include "discrete_vector.hpp"
+#include "kokkos_allocator.hpp"
+#include "parallel_deepcopy.hpp"
+
+namespace ddc {
+
+namespace detail {
+
+/// Side of a DualChunk holding the most recent modifications
+enum class DualChunkSide { none, host, device };
+
+/// @return the smallest domain containing both `lhs` and `rhs`
+template <class... DDims>
+DiscreteDomain<DDims...> bounding_domain(
+        DiscreteDomain<DDims...> const& lhs,
+        DiscreteDomain<DDims...> const& rhs)
+{
+    DiscreteElement<DDims...> const front(
+            std::min(lhs.front().template uid<DDims>(), rhs.front().template uid<DDims>())...);
+    DiscreteVector<DDims...> const extents(
+            (std::max(lhs.back().template uid<DDims>(), rhs.back().template uid<DDims>()) + 1
+             - front.template uid<DDims>())...);
+    return DiscreteDomain<DDims...>(front, extents);
+}
+
+} // namespace detail
+
+/** A Chunk mirrored in a device memory space and in the host memory space.
+ *
+ * Analogous to `Kokkos::DualView`: each side keeps its own allocation and the chunk
+ * records which side was last modified, and on which region. Taking a mutable span with
+ * `span_view<Space>()` marks the corresponding side as modified, `sync<Space>()` then
+ * copies the modified region to the side accessible from `Space`, and does nothing if
+ * that side is already up to date.
+ *
+ * When `MemorySpace` is `Kokkos::HostSpace` both sides share the same allocation and
+ * synchronisations are no-ops.
+ */
+template <
+        class ElementType,
+        class SupportType,
+        class MemorySpace = Kokkos::DefaultExecutionSpace::memory_space>
+class DualChunk
+{
+    static_assert(
+            Kokkos::is_memory_space_v<MemorySpace>,
+            "DDC: parameter \"MemorySpace\" must be a Kokkos memory space");
+
+public:
+    using element_type = ElementType;
+
+    using discrete_domain_type = SupportType;
+
+    using device_memory_space = MemorySpace;
+
+    using host_memory_space = Kokkos::HostSpace;
+
+    using device_chunk_type
+            = Chunk<ElementType, SupportType, KokkosAllocator<ElementType, MemorySpace>>;
+
+    using host_chunk_type = Chunk<ElementType, SupportType, HostAllocator<ElementType>>;
+
+    /// true if both sides share the same allocation
+    static constexpr bool is_shared = std::is_same_v<MemorySpace, Kokkos::HostSpace>;
+
+private:
+    using side = detail::DualChunkSide;
+
+    template <class Space>
+    static constexpr side side_of()
+    {
+        static_assert(
+                Kokkos::is_memory_space_v<Space> || Kokkos::is_execution_space_v<Space>,
+                "DDC: parameter \"Space\" must be either a Kokkos execution space or a memory "
+                "space");
+        if constexpr (std::is_same_v<typename Space::memory_space, MemorySpace>) {
+            return side::device;
+        } else {
+            static_assert(
+                    std::is_same_v<typename Space::memory_space, Kokkos::HostSpace>,
+                    "DDC: parameter \"Space\" must use either the device or the host memory "
+                    "space of the DualChunk");
+            return side::host;
+        }
+    }
+
+    device_chunk_type m_device;
+
+    host_chunk_type m_host;
+
+    side m_modified_side = side::none;
+
+    discrete_domain_type m_modified_domain;
+
+public:
+    /// Empty DualChunk
+    DualChunk() = default;
+
+    /** Construct a DualChunk on a domain, both sides are allocated but left uninitialized
+     * @param label name of the device allocation, the host one is suffixed with "_mirror"
+     * @param domain the domain of the chunk
+     */
+    DualChunk(std::string const& label, SupportType const& domain)
+        : m_device(label, domain)
+        , m_host(label + "_mirror",
+                 is_shared ? domain.take_first(typename SupportType::discrete_vector_type())
+                           : domain)
+        , m_modified_domain(domain)
+    {
+    }
+
+    /** Construct a DualChunk on a domain, both sides are allocated but left uninitialized
+     * @param domain the domain of the chunk
+     */
+    explicit DualChunk(SupportType const& domain) : DualChunk("no-label", domain) {}
+
+    DualChunk(DualChunk const& other) = delete;
+
+    DualChunk(DualChunk&& other) noexcept = default;
+
+    ~DualChunk() noexcept = default;
+
+    DualChunk& operator=(DualChunk const& other) = delete;
+
+    DualChunk& operator=(DualChunk&& other) noexcept = default;
+
+    discrete_domain_type domain() const noexcept
+    {
+        return m_device.domain();
+    }
+
+    std::string label() const
+    {
+        return m_device.label();
+    }
+
+    /// @return true if the side accessible from `Space` holds stale data
+    template <class Space>
+    bool need_sync() const noexcept
+    {
+        if constexpr (is_shared) {
+            return false;
+        } else {
+            return m_modified_side != side::none && m_modified_side != side_of<Space>();
+        }
+    }
+
+    /// @return the region modified since the last synchronisation, meaningful only if a side
+    /// needs a sync
+    discrete_domain_type modified_domain() const noexcept
+    {
+        return m_modified_domain;
+    }
+
+    /** Mark a region of the side accessible from `Space` as modified
+     *
+     * Successive calls on the same side extend the modified region to the bounding box of the
+     * marked regions.
+     * @param subdomain the modified region, must be included in the domain
+     * @throws std::runtime_error if the other side holds unsynchronised modifications
+     */
+    template <class Space>
+    void modify(discrete_domain_type const& subdomain)
+    {
+        assert(subdomain.empty() || domain().restrict_with(subdomain) == subdomain);
+        if constexpr (!is_shared) {
+            if (subdomain.empty()) {
+                return;
+            }
+            side const modified_side = side_of<Space>();
+            if (m_modified_side == side::none) {
+                m_modified_side = modified_side;
+                m_modified_domain = subdomain;
+            } else if (m_modified_side == modified_side) {
+                m_modified_domain = detail::bounding_domain(m_modified_domain, subdomain);
+            } else {
+                throw std::runtime_error(
+                        "DDC: both sides of the DualChunk \"" + label()
+                        + "\" have been modified without synchronisation");
+            }
+        }
+    }
+
+    /// Mark the whole side accessible from `Space` as modified
+    template <class Space>
+    void modify()
+    {
+        modify<Space>(domain());
+    }
+
+    /// Forget the pending modifications without copying anything
+    void clear_sync_state() noexcept
+    {
+        m_modified_side = side::none;
+    }
+
+    /** Copy the modified region to the side accessible from `Space` if it is stale
+     *
+     * When the whole domain is transferred, the copy is asynchronous with respect to
+     * `exec_space`: the synchronised side must not be read from another execution space
+     * before `exec_space` is fenced. A partial region is always copied synchronously, through
+     * two temporary buffers, see `copy_region`.
+     * @param exec_space the execution space used for the copies
+     */
+    template <class Space, class ExecSpace>
+    void sync(ExecSpace const& exec_space)
+    {
+        static_assert(
+                Kokkos::is_execution_space_v<ExecSpace>,
+                "DDC: parameter \"ExecSpace\" must be a Kokkos execution space");
+        if constexpr (!is_shared) {
+            if (!need_sync<Space>()) {
+                return;
+            }
+            if constexpr (side_of<Space>() == side::device) {
+                copy_region(exec_space, m_device.span_view(), m_host.span_cview());
+            } else {
+                copy_region(exec_space, m_host.span_view(), m_device.span_cview());
+            }
+            m_modified_side = side::none;
+        }
+    }
+
+    /// Copy the modified region to the side accessible from `Space` if it is stale, the side
+    /// is up to date when the function returns
+    template <class Space>
+    void sync()
+    {
+        if (need_sync<Space>()) {
+            typename Space::execution_space const exec_space;
+            sync<Space>(exec_space);
+            exec_space.fence();
+        }
+    }
+
+    /** Mutable view of the side accessible from `Space`, the whole side is marked as modified
+     * @throws std::runtime_error if the other side holds unsynchronised modifications
+     */
+    template <class Space>
+    auto span_view()
+    {
+        modify<Space>();
+        return side_span<Space>();
+    }
+
+    /** Mutable view of a region of the side accessible from `Space`, only this region is
+     * marked as modified
+     * @param subdomain the region to view, must be included in the domain
+     * @throws std::runtime_error if the other side holds unsynchronised modifications
+     */
+    template <class Space>
+    auto span_view(discrete_domain_type const& subdomain)
+    {
+        modify<Space>(subdomain);
+        return side_span<Space>()[subdomain];
+    }
+
+    /// Read-only view of the side accessible from `Space`, does not change the sync state
+    template <class Space>
+    auto span_cview() const
+    {
+        if constexpr (is_shared || side_of<Space>() == side::device) {
+            return m_device.span_cview();
+        } else {
+            return m_host.span_cview();
+        }
+    }
+
+private:
+    template <class Space>
+    auto side_span()
+    {
+        if constexpr (is_shared || side_of<Space>() == side::device) {
+            return m_device.span_view();
+        } else {
+            return m_host.span_view();
+        }
+    }
+
+    /** Copy the modified region from `src` to `dst`
+     *
+     * The whole domain is copied by a single asynchronous deep copy. A partial region being
+     * strided, it is packed into a temporary buffer on the source side, copied into a temporary
+     * buffer on the destination side and unpacked: it costs two allocations, three deep copies
+     * and a fence.
+     */
+    template <class ExecSpace, class DstSpan, class SrcSpan>
+    void copy_region(ExecSpace const& exec_space, DstSpan const& dst, SrcSpan const& src) const
+    {
+        if (m_modified_domain == domain()) {
+            parallel_deepcopy(exec_space, dst, src);
+            return;
+        }
+        Chunk src_buffer(
+                m_modified_domain,
+                KokkosAllocator<ElementType, typename SrcSpan::memory_space>());
+        parallel_deepcopy(src_buffer, src[m_modified_domain]);
+        Chunk dst_buffer = create_mirror(typename DstSpan::memory_space(), src_buffer.span_cview());
+        parallel_deepcopy(exec_space, dst_buffer, src_buffer);
+        exec_space.fence();
+        parallel_deepcopy(dst[m_modified_domain], dst_buffer);
+    }
+};
+
+} // namespace ddc
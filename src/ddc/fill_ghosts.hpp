@@ -0,0 +1,334 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include "detail/tuple/tuple.hpp"
+
+#include "chunk_traits.hpp"
+#include "discrete_domain.hpp"
+#include "discrete_element.hpp"
+#include "discrete_vector.hpp"
+
+namespace ddc {
+
+namespace detail {
+
+/** The inner points a ghost is computed from, along one dimension
+ *
+ * The value of the ghost is `weight[0] * u(index[0]) + ... + weight[nsources - 1] *
+ * u(index[nsources - 1])`, the indices being relative to the front of the inner domain. No
+ * source means the value is given by the boundary policy itself.
+ */
+struct GhostSources
+{
+    int nsources;
+
+    std::array<DiscreteVectorElement, 2> index;
+
+    std::array<DiscreteVectorElement, 2> weight;
+};
+
+} // namespace detail
+
+/// Ghosts taking the values of the inner points at the other end of the domain
+struct PeriodicGhosts
+{
+    KOKKOS_FUNCTION detail::GhostSources sources(
+            DiscreteVectorElement const i,
+            DiscreteVectorElement const n) const noexcept
+    {
+        return detail::GhostSources {1, {(i % n + n) % n, 0}, {1, 0}};
+    }
+};
+
+/// Ghosts symmetric to the inner points with respect to the boundary point
+struct MirrorGhosts
+{
+    KOKKOS_FUNCTION detail::GhostSources sources(
+            DiscreteVectorElement const i,
+            DiscreteVectorElement const n) const noexcept
+    {
+        return detail::GhostSources {1, {i < 0 ? -i : 2 * (n - 1) - i, 0}, {1, 0}};
+    }
+};
+
+/// Ghosts set to a given value
+template <class T>
+struct ConstantGhosts
+{
+    T value;
+
+    KOKKOS_FUNCTION detail::GhostSources sources(
+            DiscreteVectorElement const /*i*/,
+            DiscreteVectorElement const /*n*/) const noexcept
+    {
+        return detail::GhostSources {0, {0, 0}, {0, 0}};
+    }
+};
+
+template <class T>
+ConstantGhosts(T) -> ConstantGhosts<T>;
+
+/// Ghosts linearly extrapolated from the two inner points closest to the boundary
+struct ExtrapolatedGhosts
+{
+    KOKKOS_FUNCTION detail::GhostSources sources(
+            DiscreteVectorElement const i,
+            DiscreteVectorElement const n) const noexcept
+    {
+        if (i < 0) {
+            return detail::GhostSources {2, {0, 1}, {1 - i, i}};
+        }
+        DiscreteVectorElement const k = i - (n - 1);
+        return detail::GhostSources {2, {n - 1, n - 2}, {1 + k, -k}};
+    }
+};
+
+namespace detail {
+
+template <class T>
+struct IsConstantGhosts : std::false_type
+{
+};
+
+template <class T>
+struct IsConstantGhosts<ConstantGhosts<T>> : std::true_type
+{
+};
+
+template <class ChunkSpanType, class Support, class... Policies>
+class FillGhostsKernel;
+
+/** Fills all the ghosts of a chunk, one ghost per index
+ *
+ * The ghosts are split into slabs, the slab `d` holding the points that are ghosts along `d`,
+ * inner along the dimensions before `d` and anywhere along the dimensions after `d`, so that
+ * the corners are filled once. Each ghost only reads inner points.
+ */
+template <class ChunkSpanType, class... DDims, class... Policies>
+class FillGhostsKernel<ChunkSpanType, DiscreteDomain<DDims...>, Policies...>
+{
+    static constexpr std::size_t rank = sizeof...(DDims);
+
+    using element_type = ChunkSpanType::value_type;
+
+    using index_array = std::array<DiscreteVectorElement, rank>;
+
+    ChunkSpanType m_chunk;
+
+    DiscreteElement<DDims...> m_inner_front;
+
+    index_array m_inner_extents;
+
+    index_array m_ghosted_extents;
+
+    // number of ghosts before the inner domain
+    index_array m_pre_ghosts;
+
+    // index of the first ghost of each slab
+    std::array<std::size_t, rank + 1> m_slab_offsets;
+
+    std::array<element_type, rank> m_constants;
+
+    cexa::tuple<Policies...> m_policies;
+
+    template <class Policy>
+    static element_type constant_of(Policy const& policy)
+    {
+        if constexpr (IsConstantGhosts<Policy>::value) {
+            return static_cast<element_type>(policy.value);
+        } else {
+            return element_type();
+        }
+    }
+
+    template <std::size_t... I>
+    KOKKOS_FUNCTION element_type
+    value_at(index_array const& pos, std::index_sequence<I...> /*seq*/) const
+    {
+        std::array<GhostSources, rank> const sources {
+                (pos[I] >= 0 && pos[I] < m_inner_extents[I])
+                        ? GhostSources {1, {pos[I], 0}, {1, 0}}
+                        : cexa::get<I>(m_policies).sources(pos[I], m_inner_extents[I])...};
+        for (std::size_t d = 0; d < rank; ++d) {
+            if (sources[d].nsources == 0) {
+                return m_constants[d];
+            }
+        }
+        element_type value(0);
+        for (std::size_t combination = 0; combination < (std::size_t(1) << rank);
+             ++combination) {
+            index_array index;
+            DiscreteVectorElement weight = 1;
+            bool is_valid = true;
+            for (std::size_t d = 0; d < rank; ++d) {
+                int const isource = (combination >> d) & 1;
+                is_valid = is_valid && isource < sources[d].nsources;
+                index[d] = sources[d].index[isource];
+                weight *= sources[d].weight[isource];
+            }
+            if (is_valid) {
+                value += static_cast<element_type>(weight)
+                         * m_chunk(m_inner_front + DiscreteVector<DDims...>(index[I]...));
+            }
+        }
+        return value;
+    }
+
+public:
+    FillGhostsKernel(
+            ChunkSpanType const& chunk,
+            DiscreteDomain<DDims...> const& ghosted_domain,
+            DiscreteDomain<DDims...> const& inner_domain,
+            Policies const&... policies)
+        : m_chunk(chunk)
+        , m_inner_front(inner_domain.front())
+        , m_inner_extents(detail::array(inner_domain.extents()))
+        , m_ghosted_extents(detail::array(ghosted_domain.extents()))
+        , m_pre_ghosts(detail::array(inner_domain.front() - ghosted_domain.front()))
+        , m_slab_offsets {}
+        , m_constants {constant_of(policies)...}
+        , m_policies(policies...)
+    {
+        for (std::size_t d = 0; d < rank; ++d) {
+            auto slab_size = static_cast<std::size_t>(m_ghosted_extents[d] - m_inner_extents[d]);
+            for (std::size_t e = 0; e < rank; ++e) {
+                if (e != d) {
+                    slab_size *= static_cast<std::size_t>(
+                            e < d ? m_inner_extents[e] : m_ghosted_extents[e]);
+                }
+            }
+            m_slab_offsets[d + 1] = m_slab_offsets[d] + slab_size;
+        }
+    }
+
+    /// @return the number of ghosts
+    std::size_t size() const noexcept
+    {
+        return m_slab_offsets[rank];
+    }
+
+    KOKKOS_FUNCTION void operator()(std::size_t const ighost) const
+    {
+        std::size_t slab = 0;
+        while (ighost >= m_slab_offsets[slab + 1]) {
+            ++slab;
+        }
+        // position relative to the front of the inner domain
+        index_array pos;
+        std::size_t remainder = ighost - m_slab_offsets[slab];
+        for (std::size_t d = rank; d-- > 0;) {
+            if (d < slab) {
+                auto const n = static_cast<std::size_t>(m_inner_extents[d]);
+                pos[d] = static_cast<DiscreteVectorElement>(remainder % n);
+                remainder /= n;
+            } else if (d == slab) {
+                auto const n = static_cast<std::size_t>(m_ghosted_extents[d] - m_inner_extents[d]);
+                auto const i = static_cast<DiscreteVectorElement>(remainder % n);
+                remainder /= n;
+                pos[d] = i < m_pre_ghosts[d] ? i - m_pre_ghosts[d]
+                                             : m_inner_extents[d] + i - m_pre_ghosts[d];
+            } else {
+                auto const n = static_cast<std::size_t>(m_ghosted_extents[d]);
+                pos[d] = static_cast<DiscreteVectorElement>(remainder % n) - m_pre_ghosts[d];
+                remainder /= n;
+            }
+        }
+        m_chunk(m_inner_front + to_vector(pos, std::make_index_sequence<rank>()))
+                = value_at(pos, std::make_index_sequence<rank>());
+    }
+
+private:
+    template <std::size_t... I>
+    static KOKKOS_FUNCTION DiscreteVector<DDims...>
+    to_vector(index_array const& pos, std::index_sequence<I...> /*seq*/) noexcept
+    {
+        return DiscreteVector<DDims...>(pos[I]...);
+    }
+};
+
+} // namespace detail
+
+/** Fill all the ghosts of a chunk, corners included, in a single kernel
+ *
+ * The ghosts are the points of `ghosted_domain` outside of `inner_domain`, as returned by
+ * `init_ghosted`. Along each dimension they are computed from the inner points following a
+ * boundary policy: `PeriodicGhosts`, `MirrorGhosts`, `ConstantGhosts` or `ExtrapolatedGhosts`.
+ * In a corner the policies are combined, a constant policy along one of the dimensions taking
+ * precedence over the others. The number of ghosts on each side must be smaller than the
+ * extent of the inner domain.
+ * @param[in] execution_space a Kokkos execution space where the loop will be executed on
+ * @param[out] chunk the borrowed chunk, defined at least on `ghosted_domain`
+ * @param[in] ghosted_domain the domain including the ghosts
+ * @param[in] inner_domain the domain without the ghosts
+ * @param[in] policies the boundary policy along each dimension of the domains
+ */
+template <class ExecSpace, concepts::borrowed_chunk ChunkDst, class... DDims, class... Policies>
+void fill_ghosts(
+        ExecSpace const& execution_space,
+        ChunkDst&& chunk,
+        DiscreteDomain<DDims...> const& ghosted_domain,
+        DiscreteDomain<DDims...> const& inner_domain,
+        Policies const&... policies)
+{
+    static_assert(
+            sizeof...(Policies) == sizeof...(DDims),
+            "DDC: fill_ghosts expects one boundary policy per dimension");
+    static_assert(is_writable_chunk_v<ChunkDst>, "DDC: the chunk must be writable");
+    assert(ghosted_domain.restrict_with(inner_domain) == inner_domain);
+    [[maybe_unused]] DiscreteVector<DDims...> const pre_ghosts
+            = inner_domain.front() - ghosted_domain.front();
+    [[maybe_unused]] DiscreteVector<DDims...> const post_ghosts
+            = ghosted_domain.back() - inner_domain.back();
+    assert(((get<DDims>(pre_ghosts) < get<DDims>(inner_domain.extents())
+             && get<DDims>(post_ghosts) < get<DDims>(inner_domain.extents()))
+            && ...));
+    detail::FillGhostsKernel<
+            decltype(chunk.span_view()),
+            DiscreteDomain<DDims...>,
+            Policies...> const kernel(chunk.span_view(), ghosted_domain, inner_domain, policies...);
+    if (kernel.size() == 0) {
+        return;
+    }
+    Kokkos::parallel_for(
+            "ddc_fill_ghosts",
+            Kokkos::RangePolicy<ExecSpace, Kokkos::IndexType<std::size_t>>(
+                    execution_space,
+                    0,
+                    kernel.size()),
+            kernel);
+}
+
+/** Fill all the ghosts of a chunk, corners included, in a single kernel using the `Kokkos`
+ * default execution space
+ * @param[out] chunk the borrowed chunk, defined at least on `ghosted_domain`
+ * @param[in] ghosted_domain the domain including the ghosts
+ * @param[in] inner_domain the domain without the ghosts
+ * @param[in] policies the boundary policy along each dimension of the domains
+ */
+template <concepts::borrowed_chunk ChunkDst, class... DDims, class... Policies>
+void fill_ghosts(
+        ChunkDst&& chunk,
+        DiscreteDomain<DDims...> const& ghosted_domain,
+        DiscreteDomain<DDims...> const& inner_domain,
+        Policies const&... policies)
+{
+    fill_ghosts(
+            Kokkos::DefaultExecutionSpace(),
+            std::forward<ChunkDst>(chunk),
+            ghosted_domain,
+            inner_domain,
+            policies...);
+}
+
+} // namespace ddc
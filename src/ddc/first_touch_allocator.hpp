@@ -0,0 +1,169 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <new>
+#include <string>
+#include <type_traits>
+
+#include <Kokkos_Core.hpp>
+
+#include "discrete_vector.hpp"
+#include "kokkos_allocator.hpp"
+#include "parallel_for_each.hpp"
+
+namespace ddc {
+
+namespace detail {
+
+/// Value-initializes the element of a layout right allocation at the position of an index
+template <class T, class Support>
+class FirstTouchFunctor
+{
+    T* m_ptr;
+
+    Support m_domain;
+
+public:
+    FirstTouchFunctor(T* const ptr, Support const& domain) : m_ptr(ptr), m_domain(domain) {}
+
+    KOKKOS_FUNCTION void operator()(typename Support::discrete_element_type const& delem) const
+    {
+        std::array const ids = detail::array(m_domain.distance_from_front(delem));
+        std::array const size = detail::array(m_domain.extents());
+        std::size_t offset = 0;
+        for (std::size_t i = 0; i < ids.size(); ++i) {
+            offset = offset * static_cast<std::size_t>(size[i]) + static_cast<std::size_t>(ids[i]);
+        }
+        ::new (static_cast<void*>(m_ptr + offset)) T();
+    }
+};
+
+} // namespace detail
+
+/** An allocator of host memory whose pages are first touched in parallel.
+ *
+ * With a first-touch NUMA policy, a page is mapped on the memory of the socket of the thread
+ * that first writes it. When a Chunk is built with this allocator, its values are
+ * value-initialized by a `parallel_for_each` over its domain on `ExecSpace`, so that each page
+ * lies close to the thread that accesses it in the subsequent loops over the same domain with
+ * the same execution space. Only allocations made with a label and a domain benefit from this
+ * exact mapping, other allocations are touched with a 1D range.
+ * @tparam T the type of the elements
+ * @tparam ExecSpace a Kokkos execution space accessing the host memory, ideally the one of the
+ *         compute loops
+ */
+template <class T, class ExecSpace = Kokkos::DefaultHostExecutionSpace>
+class FirstTouchAllocator
+{
+    static_assert(
+            Kokkos::SpaceAccessibility<ExecSpace, Kokkos::HostSpace>::accessible,
+            "The execution space must be able to access the host memory");
+
+    using base_allocator_type = KokkosAllocator<T, Kokkos::HostSpace>;
+
+public:
+    using value_type = T;
+
+    using memory_space = Kokkos::HostSpace;
+
+    using execution_space = ExecSpace;
+
+    template <class U>
+    struct rebind
+    {
+        using other = FirstTouchAllocator<U, ExecSpace>;
+    };
+
+    constexpr FirstTouchAllocator() = default;
+
+    constexpr FirstTouchAllocator(FirstTouchAllocator const& x) = default;
+
+    constexpr FirstTouchAllocator(FirstTouchAllocator&& x) noexcept = default;
+
+    template <class U>
+    constexpr explicit FirstTouchAllocator(FirstTouchAllocator<U, ExecSpace> const&) noexcept
+    {
+    }
+
+    ~FirstTouchAllocator() = default;
+
+    constexpr FirstTouchAllocator& operator=(FirstTouchAllocator const& x) = default;
+
+    constexpr FirstTouchAllocator& operator=(FirstTouchAllocator&& x) noexcept = default;
+
+    template <class U>
+    constexpr FirstTouchAllocator& operator=(FirstTouchAllocator<U, ExecSpace> const&) noexcept
+    {
+    }
+
+    [[nodiscard]] T* allocate(std::size_t n) const
+    {
+        return allocate("ddc_first_touch_allocator", n);
+    }
+
+    [[nodiscard]] T* allocate(std::string const& label, std::size_t n) const
+    {
+        T* const ptr = base_allocator_type().allocate(label, n);
+        ExecSpace const execution_space;
+        Kokkos::parallel_for(
+                "ddc_first_touch",
+                Kokkos::RangePolicy<ExecSpace, Kokkos::IndexType<std::size_t>>(
+                        execution_space,
+                        0,
+                        n),
+                KOKKOS_LAMBDA(std::size_t const i) { ::new (static_cast<void*>(ptr + i)) T(); });
+        execution_space.fence("ddc_first_touch");
+        return ptr;
+    }
+
+    /** Allocates the storage of a layout right chunk and touches it with the same partitioning of
+     * the domain as `parallel_for_each`
+     * @param[in] label the label of the allocation
+     * @param[in] domain the domain of the chunk
+     */
+    template <class Support>
+    [[nodiscard]] T* allocate(std::string const& label, Support const& domain) const
+        requires(!std::is_convertible_v<Support, std::size_t>)
+    {
+        T* const ptr = base_allocator_type().allocate(label, domain.size());
+        ExecSpace const execution_space;
+        parallel_for_each(
+                "ddc_first_touch",
+                execution_space,
+                domain,
+                detail::FirstTouchFunctor<T, Support>(ptr, domain));
+        execution_space.fence("ddc_first_touch");
+        return ptr;
+    }
+
+    void deallocate(T* p, std::size_t n) const
+    {
+        base_allocator_type().deallocate(p, n);
+    }
+};
+
+template <class T, class EST, class U, class ESU>
+constexpr bool operator==(
+        FirstTouchAllocator<T, EST> const&,
+        FirstTouchAllocator<U, ESU> const&) noexcept
+{
+    return std::is_same_v<FirstTouchAllocator<T, EST>, FirstTouchAllocator<U, ESU>>;
+}
+
+#if !defined(__cpp_impl_three_way_comparison) || __cpp_impl_three_way_comparison < 201902L
+// In C++20, `a!=b` shall be automatically translated by the compiler to `!(a==b)`
+template <class T, class EST, class U, class ESU>
+constexpr bool operator!=(
+        FirstTouchAllocator<T, EST> const&,
+        FirstTouchAllocator<U, ESU> const&) noexcept
+{
+    return !std::is_same_v<FirstTouchAllocator<T, EST>, FirstTouchAllocator<U, ESU>>;
+}
+#endif
+
+} // namespace ddc
@@ -4,11 +4,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <utility>
 
-#include <Kokkos_Macros.hpp>
+#include <Kokkos_Core.hpp>
+
+#include "detail/host_blocks.hpp"
 
 #include "discrete_vector.hpp"
 
@@ -50,6 +53,44 @@ KOKKOS_FUNCTION void device_for_each_serial(
     }
 }
 
+/** iterates in serial over the elements `[begin, end)` of a nD domain, enumerated in the
+ * row-major order
+ * @param[in] domain the domain over which to iterate
+ * @param[in] size   the extents of the domain
+ * @param[in] begin  the first linear index of the block
+ * @param[in] end    the linear index past the last element of the block
+ * @param[in] f      a functor taking an index as parameter
+ */
+template <class Support, std::size_t N, class Functor>
+void host_for_each_block(
+        Support const& domain,
+        std::array<DiscreteVectorElement, N> const& size,
+        std::size_t const begin,
+        std::size_t const end,
+        Functor const& f) noexcept
+{
+    if constexpr (N == 0) {
+        f(domain(typename Support::discrete_vector_type()));
+    } else {
+        std::array<DiscreteVectorElement, N> ids;
+        std::size_t remainder = begin;
+        for (std::size_t i = N; i-- > 0;) {
+            ids[i] = static_cast<DiscreteVectorElement>(
+                    remainder % static_cast<std::size_t>(size[i]));
+            remainder /= static_cast<std::size_t>(size[i]);
+        }
+        for (std::size_t k = begin; k < end; ++k) {
+            f(domain(typename Support::discrete_vector_type(ids)));
+            for (std::size_t i = N; i-- > 0;) {
+                if (++ids[i] < size[i]) {
+                    break;
+                }
+                ids[i] = 0;
+            }
+        }
+    }
+}
+
 } // namespace detail
 
 /** iterates over a nD domain in serial
@@ -62,6 +103,40 @@ void host_for_each(Support const& domain, Functor&& f) noexcept
     detail::host_for_each_serial(domain, detail::array(domain.extents()), std::forward<Functor>(f));
 }
 
+/** iterates over a nD domain in parallel using a host `Kokkos` execution space, returns when
+ * all the iterations are completed
+ * @param[in] execution_space a Kokkos execution space accessing the host memory
+ * @param[in] domain the domain over which to iterate
+ * @param[in] f      a functor taking an index as parameter
+ */
+template <class ExecSpace, class Support, class Functor>
+void host_for_each(ExecSpace const& execution_space, Support const& domain, Functor&& f) noexcept
+    requires(Kokkos::is_execution_space_v<ExecSpace>)
+{
+    static_assert(
+            Kokkos::SpaceAccessibility<ExecSpace, Kokkos::HostSpace>::accessible,
+            "The execution space must be able to access the host memory");
+    std::array const size = detail::array(domain.extents());
+    std::size_t const nelems = domain.size();
+    std::size_t const block_size = detail::host_block_size;
+    std::size_t const nblocks = (nelems + block_size - 1) / block_size;
+    Kokkos::parallel_for(
+            "ddc_host_for_each",
+            Kokkos::RangePolicy<ExecSpace, Kokkos::IndexType<std::size_t>>(
+                    execution_space,
+                    0,
+                    nblocks),
+            [&](std::size_t const iblock) {
+                detail::host_for_each_block(
+                        domain,
+                        size,
+                        iblock * block_size,
+                        std::min(nelems, (iblock + 1) * block_size),
+                        f);
+            });
+    execution_space.fence("ddc_host_for_each");
+}
+
 /** iterates over a nD domain in serial
  * @param[in] domain the domain over which to iterate
  * @param[in] f      a functor taking an index as parameter
@@ -0,0 +1,141 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <string>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#include <Kokkos_Core.hpp>
+
+#include "memory_accounting.hpp"
+
+namespace ddc {
+
+/** An allocator of host memory for large arrays.
+ *
+ * All the allocations are aligned on `N` bytes. The allocations of at least `huge_page_size`
+ * bytes are aligned on a huge page boundary and, when the system supports it, the kernel is
+ * advised to back them with transparent huge pages to reduce the TLB misses. The allocations are
+ * reported to the Kokkos profiling tools and to the DDC memory accounting with their label.
+ * @tparam T the type of the elements
+ * @tparam N the minimal alignment in bytes, a power of two
+ */
+template <class T, std::size_t N = 64>
+class HugePageAllocator
+{
+    static_assert((N & (N - 1)) == 0, "The alignment must be a power of two");
+
+    static_assert(N >= alignof(T), "The alignment must be at least the one of the type");
+
+public:
+    using value_type = T;
+
+    using memory_space = Kokkos::HostSpace;
+
+    /// The size of the transparent huge pages on x86-64
+    static constexpr std::size_t huge_page_size = 2 * 1024 * 1024;
+
+    template <class U>
+    struct rebind
+    {
+        using other = HugePageAllocator<U, N>;
+    };
+
+    constexpr HugePageAllocator() = default;
+
+    constexpr HugePageAllocator(HugePageAllocator const& x) = default;
+
+    constexpr HugePageAllocator(HugePageAllocator&& x) noexcept = default;
+
+    template <class U>
+    constexpr explicit HugePageAllocator(HugePageAllocator<U, N> const&) noexcept
+    {
+    }
+
+    ~HugePageAllocator() = default;
+
+    constexpr HugePageAllocator& operator=(HugePageAllocator const& x) = default;
+
+    constexpr HugePageAllocator& operator=(HugePageAllocator&& x) noexcept = default;
+
+    template <class U>
+    constexpr HugePageAllocator& operator=(HugePageAllocator<U, N> const&) noexcept
+    {
+    }
+
+    /// Returns the alignment in bytes of an allocation of `n` elements
+    static constexpr std::size_t alignment(std::size_t n) noexcept
+    {
+        return sizeof(T) * n >= huge_page_size ? std::max(N, huge_page_size) : N;
+    }
+
+    [[nodiscard]] T* allocate(std::size_t n) const
+    {
+        return allocate("ddc_huge_page_allocator", n);
+    }
+
+    [[nodiscard]] T* allocate(std::string const& label, std::size_t n) const
+    {
+        std::size_t const nbytes = sizeof(T) * n;
+        void* const ptr = ::operator new(nbytes, std::align_val_t(alignment(n)));
+#if defined(MADV_HUGEPAGE)
+        if (nbytes >= huge_page_size) {
+            // Only a hint, the allocation remains valid if the kernel ignores it
+            static_cast<void>(madvise(ptr, nbytes - nbytes % huge_page_size, MADV_HUGEPAGE));
+        }
+#endif
+        detail::record_allocation(ptr, memory_space::name(), label, nbytes);
+        if (Kokkos::Profiling::profileLibraryLoaded()) {
+            Kokkos::Profiling::allocateData(
+                    Kokkos::Profiling::make_space_handle(memory_space::name()),
+                    label,
+                    ptr,
+                    nbytes);
+        }
+        return static_cast<T*>(ptr);
+    }
+
+    void deallocate(T* p, std::size_t n) const
+    {
+        deallocate("ddc_huge_page_allocator", p, n);
+    }
+
+    void deallocate(std::string const& label, T* p, std::size_t n) const
+    {
+        if (Kokkos::Profiling::profileLibraryLoaded()) {
+            Kokkos::Profiling::deallocateData(
+                    Kokkos::Profiling::make_space_handle(memory_space::name()),
+                    label,
+                    p,
+                    sizeof(T) * n);
+        }
+        detail::record_deallocation(p);
+        ::operator delete(p, std::align_val_t(alignment(n)));
+    }
+};
+
+template <class T, std::size_t NT, class U, std::size_t NU>
+constexpr bool operator==(HugePageAllocator<T, NT> const&, HugePageAllocator<U, NU> const&) noexcept
+{
+    return std::is_same_v<HugePageAllocator<T, NT>, HugePageAllocator<U, NU>>;
+}
+
+#if !defined(__cpp_impl_three_way_comparison) || __cpp_impl_three_way_comparison < 201902L
+// In C++20, `a!=b` shall be automatically translated by the compiler to `!(a==b)`
+template <class T, std::size_t NT, class U, std::size_t NU>
+constexpr bool operator!=(HugePageAllocator<T, NT> const&, HugePageAllocator<U, NU> const&) noexcept
+{
+    return !std::is_same_v<HugePageAllocator<T, NT>, HugePageAllocator<U, NU>>;
+}
+#endif
+
+} // namespace ddc
@@ -4,9 +4,11 @@
 
 #pragma once
 
+#include "splines/batch_parallelism.hpp"
 #include "splines/bsplines_non_uniform.hpp"
 #include "splines/bsplines_uniform.hpp"
 #include "splines/constant_extrapolation_rule.hpp"
+#include "splines/coordinate_functor.hpp"
 #include "splines/deriv.hpp"
 #include "splines/greville_interpolation_points.hpp"
 #include "splines/integrals.hpp"
@@ -0,0 +1,49 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+#include <Kokkos_Core.hpp>
+
+namespace ddc::detail {
+
+/// The default minimal gain of occupancy for a batch to run over its points, see is_small_batch
+inline constexpr double default_small_batch_threshold = 2.;
+
+/**
+ * @brief Whether a batch is too small to give one line of work to each thread of an execution space.
+ *
+ * The batched kernels of the splines then run over all the points of the batched domain, one point
+ * per index, instead of over the batch with a serial loop along each line, so that a short batch
+ * (e.g. a 1D problem or a 2D problem with a short batch dimension) still occupies the whole
+ * execution space.
+ *
+ * Running one line per thread occupies batch_size threads, running one point per thread occupies
+ * up to batch_size * line_size threads. The batch is small when the second occupies at least
+ * threshold times more threads than the first, as the loop along a line may reuse the work of the
+ * previous point: a batch of short lines or a batch nearly filling the execution space keeps its
+ * loop along each line.
+ *
+ * @param exec_space The execution space running the kernel.
+ * @param batch_size The number of lines in the batch.
+ * @param line_size The number of points in each line.
+ * @param threshold The minimal gain of occupancy: 0 always runs over the points, infinity never.
+ */
+template <class ExecSpace>
+bool is_small_batch(
+        ExecSpace const& exec_space,
+        std::size_t const batch_size,
+        std::size_t const line_size,
+        double const threshold = default_small_batch_threshold)
+{
+    std::size_t const concurrency = static_cast<std::size_t>(exec_space.concurrency());
+    double const occupancy_gain = static_cast<double>(std::min(concurrency, batch_size * line_size))
+                                  / static_cast<double>(std::max(batch_size, std::size_t(1)));
+    return occupancy_gain >= threshold;
+}
+
+} // namespace ddc::detail
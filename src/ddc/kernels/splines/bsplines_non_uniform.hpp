@@ -217,6 +217,22 @@ public:
         KOKKOS_INLINE_FUNCTION discrete_element_type
         eval_basis(DSpan1D values, ddc::Coordinate<CDim> const& x) const;
 
+        /** @brief Evaluates non-zero B-splines at a given coordinate close to a previous one.
+         *
+         * Same as eval_basis but the cell containing x is found by walking the cells from the one of a
+         * previous evaluation instead of searching all of them. This is cheaper when the coordinates are
+         * evaluated in order, e.g. along a sorted line of points.
+         *
+         * @param[out] values The values of the B-splines evaluated at coordinate x. It has to be a 1D mdspan with (degree+1) elements.
+         * @param[in] x The coordinate where B-splines are evaluated. It has to be in the range of break points coordinates.
+         * @param[in] jmin_hint The index of the first B-spline returned by a previous evaluation.
+         * @return The index of the first B-spline which is evaluated.
+         */
+        KOKKOS_INLINE_FUNCTION discrete_element_type eval_basis_near(
+                DSpan1D values,
+                ddc::Coordinate<CDim> const& x,
+                discrete_element_type const& jmin_hint) const;
+
         /** @brief Evaluates non-zero B-spline derivatives at a given coordinate
          *
          * The derivatives are computed for every B-spline with support at the given coordinate x. There are only (degree+1)
@@ -388,6 +404,22 @@ public:
          */
         KOKKOS_INLINE_FUNCTION ddc::DiscreteElement<knot_discrete_dimension_type> find_cell_start(
                 ddc::Coordinate<CDim> const& x) const;
+
+        /**
+         * @brief Get the DiscreteElement describing the knot at the start of the cell where x is found,
+         * walking the cells from a given one.
+         * @param x The point whose location must be determined.
+         * @param icell_hint The knot at the start of the cell the walk starts from.
+         * @returns The DiscreteElement describing the knot at the lower bound of the cell of interest.
+         */
+        KOKKOS_INLINE_FUNCTION ddc::DiscreteElement<knot_discrete_dimension_type> find_cell_start(
+                ddc::Coordinate<CDim> const& x,
+                ddc::DiscreteElement<knot_discrete_dimension_type> icell_hint) const;
+
+        KOKKOS_INLINE_FUNCTION discrete_element_type eval_basis_in_cell(
+                DSpan1D values,
+                ddc::Coordinate<CDim> const& x,
+                ddc::DiscreteElement<knot_discrete_dimension_type> const& icell) const;
     };
 };
 
@@ -460,6 +492,33 @@ template <class CDim, std::size_t D>
 template <class DDim, class MemorySpace>
 KOKKOS_INLINE_FUNCTION ddc::DiscreteElement<DDim> NonUniformBSplines<CDim, D>::
         Impl<DDim, MemorySpace>::eval_basis(DSpan1D values, ddc::Coordinate<CDim> const& x) const
+{
+    // 1. Compute cell index 'icell'
+    return eval_basis_in_cell(values, x, find_cell_start(x));
+}
+
+template <class CDim, std::size_t D>
+template <class DDim, class MemorySpace>
+KOKKOS_INLINE_FUNCTION ddc::DiscreteElement<DDim> NonUniformBSplines<CDim, D>::
+        Impl<DDim, MemorySpace>::eval_basis_near(
+                DSpan1D values,
+                ddc::Coordinate<CDim> const& x,
+                discrete_element_type const& jmin_hint) const
+{
+    // 1. Compute cell index 'icell' from the cell of the hint
+    return eval_basis_in_cell(
+            values,
+            x,
+            find_cell_start(x, m_break_point_domain.front() + (jmin_hint - m_reference).value()));
+}
+
+template <class CDim, std::size_t D>
+template <class DDim, class MemorySpace>
+KOKKOS_INLINE_FUNCTION ddc::DiscreteElement<DDim> NonUniformBSplines<CDim, D>::
+        Impl<DDim, MemorySpace>::eval_basis_in_cell(
+                DSpan1D values,
+                ddc::Coordinate<CDim> const& x,
+                ddc::DiscreteElement<knot_discrete_dimension_type> const& icell) const
 {
     KOKKOS_ASSERT(values.size() == D + 1)
 
@@ -470,9 +529,6 @@ KOKKOS_INLINE_FUNCTION ddc::DiscreteElement<DDim> NonUniformBSplines<CDim, D>::
     KOKKOS_ASSERT(rmax() - x >= -length() * 1e-14)
     KOKKOS_ASSERT(values.size() == degree() + 1)
 
-    // 1. Compute cell index 'icell'
-    ddc::DiscreteElement<knot_discrete_dimension_type> const icell = find_cell_start(x);
-
     KOKKOS_ASSERT(icell >= m_break_point_domain.front())
     KOKKOS_ASSERT(icell <= m_break_point_domain.back())
     KOKKOS_ASSERT(ddc::coordinate(icell) - x <= length() * 1e-14)
@@ -679,17 +735,42 @@ KOKKOS_INLINE_FUNCTION ddc::DiscreteElement<NonUniformBsplinesKnots<DDim>> NonUn
         return m_break_point_domain.back() - 1;
     }
 
-    // Binary search
-    ddc::DiscreteElement<knot_discrete_dimension_type> low = m_break_point_domain.front();
-    ddc::DiscreteElement<knot_discrete_dimension_type> high = m_break_point_domain.back();
-    ddc::DiscreteElement<knot_discrete_dimension_type> icell = low + (high - low) / 2;
-    while (x < ddc::coordinate(icell) || x >= ddc::coordinate(icell + 1)) {
-        if (x < ddc::coordinate(icell)) {
-            high = icell;
-        } else {
-            low = icell;
-        }
-        icell = low + (high - low) / 2;
+    // The knots are a NonUniformPointSampling whose bucket grid brackets the cell of x
+    return ddc::locate<knot_discrete_dimension_type>(x);
+}
+
+template <class CDim, std::size_t D>
+template <class DDim, class MemorySpace>
+KOKKOS_INLINE_FUNCTION ddc::DiscreteElement<NonUniformBsplinesKnots<DDim>> NonUniformBSplines<
+        CDim,
+        D>::Impl<DDim, MemorySpace>::
+        find_cell_start(
+                ddc::Coordinate<CDim> const& x,
+                ddc::DiscreteElement<knot_discrete_dimension_type> const icell_hint) const
+{
+    KOKKOS_ASSERT(x - rmin() >= -length() * 1e-14)
+    KOKKOS_ASSERT(rmax() - x >= -length() * 1e-14)
+
+    if (x <= rmin()) {
+        return m_break_point_domain.front();
+    }
+    if (x >= rmax()) {
+        return m_break_point_domain.back() - 1;
+    }
+
+    // The walk stays in the break points as rmin < x < rmax
+    ddc::DiscreteElement<knot_discrete_dimension_type> icell = icell_hint;
+    if (icell < m_break_point_domain.front()) {
+        icell = m_break_point_domain.front();
+    }
+    if (icell > m_break_point_domain.back() - 1) {
+        icell = m_break_point_domain.back() - 1;
+    }
+    while (x < ddc::coordinate(icell)) {
+        --icell;
+    }
+    while (x >= ddc::coordinate(icell + 1)) {
+        ++icell;
     }
     return icell;
 }
@@ -207,6 +207,23 @@ public:
             return eval_basis(values, x, degree());
         }
 
+        /** @brief Evaluates non-zero B-splines at a given coordinate close to a previous one.
+         *
+         * Same as eval_basis, the cell of a uniform B-spline being directly computed from x the hint is unused.
+         * It is provided so that uniform and non-uniform B-splines can be evaluated along sorted points alike.
+         *
+         * @param[out] values The values of the B-splines evaluated at coordinate x. It has to be a 1D mdspan with (degree+1) elements.
+         * @param[in] x The coordinate where B-splines are evaluated. It has to be in the range of break points coordinates.
+         * @return The index of the first B-spline which is evaluated.
+         */
+        KOKKOS_INLINE_FUNCTION discrete_element_type eval_basis_near(
+                DSpan1D values,
+                ddc::Coordinate<CDim> const& x,
+                discrete_element_type const& /*jmin_hint*/) const
+        {
+            return eval_basis(values, x);
+        }
+
         /** @brief Evaluates non-zero B-spline derivatives at a given coordinate
          *
          * The derivatives are computed for every B-spline with support at the given coordinate x. There are only (degree+1)
@@ -4,7 +4,6 @@
 
 #pragma once
 
-#include <array>
 #include <cstddef>
 
 #include <ddc/ddc.hpp>
@@ -57,16 +56,17 @@ public:
         // `pos` is always unused, but needed for Doxygen
         static_assert(in_tags_v<DimI, to_type_seq_t<CoordType>>);
 
-        std::array<double, BSplines::degree() + 1> vals_ptr;
-        Kokkos::mdspan<double, Kokkos::extents<std::size_t, BSplines::degree() + 1>> const vals(
-                vals_ptr.data());
+        ddc::LocalChunk<
+                double,
+                ddc::StaticDiscreteDomain<ddc::DiscreteDomain<BSplines>, BSplines::degree() + 1>>
+                vals;
 
         ddc::DiscreteElement<BSplines> const idx
-                = ddc::discrete_space<BSplines>().eval_basis(vals, m_eval_pos);
+                = ddc::discrete_space<BSplines>().eval_basis(vals.allocation_mdspan(), m_eval_pos);
 
         double y = 0.0;
         for (std::size_t i = 0; i < BSplines::degree() + 1; ++i) {
-            y += spline_coef(idx + i) * vals[i];
+            y += spline_coef(idx + i) * vals(ddc::DiscreteVector<BSplines>(i));
         }
         return y;
     }
@@ -169,24 +169,27 @@ public:
                                   m_eval_pos_not_interest_max));
         }
 
-        std::array<double, BSplines1::degree() + 1> vals1_ptr;
-        Kokkos::mdspan<double, Kokkos::extents<std::size_t, BSplines1::degree() + 1>> const vals1(
-                vals1_ptr.data());
-        std::array<double, BSplines2::degree() + 1> vals2_ptr;
-        Kokkos::mdspan<double, Kokkos::extents<std::size_t, BSplines2::degree() + 1>> const vals2(
-                vals2_ptr.data());
+        ddc::LocalChunk<
+                double,
+                ddc::StaticDiscreteDomain<ddc::DiscreteDomain<BSplines1>, BSplines1::degree() + 1>>
+                vals1;
+        ddc::LocalChunk<
+                double,
+                ddc::StaticDiscreteDomain<ddc::DiscreteDomain<BSplines2>, BSplines2::degree() + 1>>
+                vals2;
 
         ddc::DiscreteElement<BSplines1> const idx1 = ddc::discrete_space<BSplines1>().eval_basis(
-                vals1,
+                vals1.allocation_mdspan(),
                 ddc::Coordinate<typename BSplines1::continuous_dimension_type>(eval_pos));
         ddc::DiscreteElement<BSplines2> const idx2 = ddc::discrete_space<BSplines2>().eval_basis(
-                vals2,
+                vals2.allocation_mdspan(),
                 ddc::Coordinate<typename BSplines2::continuous_dimension_type>(eval_pos));
 
         double y = 0.0;
         for (std::size_t i = 0; i < BSplines1::degree() + 1; ++i) {
             for (std::size_t j = 0; j < BSplines2::degree() + 1; ++j) {
-                y += spline_coef(idx1 + i, idx2 + j) * vals1[i] * vals2[j];
+                y += spline_coef(idx1 + i, idx2 + j) * vals1(ddc::DiscreteVector<BSplines1>(i))
+                     * vals2(ddc::DiscreteVector<BSplines2>(j));
             }
         }
 
@@ -0,0 +1,28 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <type_traits>
+
+#include <ddc/ddc.hpp>
+
+namespace ddc::concepts {
+
+/**
+ * @brief A functor giving the coordinate of each point of a batched domain.
+ *
+ * It is called on the DiscreteElements of the domain, e.g. to compute the feet of the characteristics
+ * on the fly in the evaluation kernel of a spline evaluator instead of storing them in a Chunk. Chunks
+ * are excluded so that they keep using the overloads taking a ChunkSpan of coordinates.
+ *
+ * @tparam F The type of the functor, callable on the device.
+ * @tparam DDom The batched domain whose points are given to the functor.
+ */
+template <class F, class DDom>
+concept coordinate_functor
+        = !is_borrowed_chunk_v<F>
+          && std::is_invocable_v<F const&, typename DDom::discrete_element_type const&>;
+
+} // namespace ddc::concepts
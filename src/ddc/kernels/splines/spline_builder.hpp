@@ -18,6 +18,7 @@
 
 #include <Kokkos_Core.hpp>
 
+#include "batch_parallelism.hpp"
 #include "deriv.hpp"
 #include "integrals.hpp"
 #include "math_tools.hpp"
@@ -1039,17 +1040,46 @@ operator()(
             batched_spline_tr_domain(batched_interpolation_domain),
             ddc::KokkosAllocator<double, memory_space>());
     ddc::ChunkSpan const spline_tr = spline_tr_alloc.span_view();
-    ddc::parallel_for_each(
-            m_label + " > ddc_splines_transpose_rhs",
+    // When the batch is too small to occupy the execution space, the transpositions run over
+    // the coefficients of all the lines instead of looping over each line
+    using transpose_element_type
+            = batched_spline_tr_domain_type<BatchedInterpolationDDom>::discrete_element_type;
+    bool const is_small_batch = detail::is_small_batch(
             exec_space(),
-            batch_domain(batched_interpolation_domain),
-            KOKKOS_LAMBDA(
-                    batch_domain_type<BatchedInterpolationDDom>::discrete_element_type const j) {
-                for (std::size_t i = 0; i < nbasis_proxy; ++i) {
-                    spline_tr(ddc::DiscreteElement<bsplines_type>(i), j)
-                            = spline(ddc::DiscreteElement<bsplines_type>(i + offset_proxy), j);
-                }
-            });
+            batch_domain(batched_interpolation_domain).size(),
+            nbasis_proxy);
+    batched_spline_tr_domain_type<BatchedInterpolationDDom> const transpose_domain
+            = ddc::replace_dim_of<bsplines_type, bsplines_type>(
+                    spline_tr.domain(),
+                    ddc::DiscreteDomain<bsplines_type>(
+                            ddc::DiscreteElement<bsplines_type>(0),
+                            ddc::DiscreteVector<bsplines_type>(nbasis_proxy)));
+    if (is_small_batch) {
+        ddc::parallel_for_each(
+                m_label + " > ddc_splines_transpose_rhs",
+                exec_space(),
+                transpose_domain,
+                KOKKOS_LAMBDA(transpose_element_type const e) {
+                    ddc::DiscreteElement<bsplines_type> const i(e);
+                    spline_tr(e) = spline(
+                            i + offset_proxy,
+                            batch_domain_type<BatchedInterpolationDDom>::discrete_element_type(e));
+                });
+    } else {
+        ddc::parallel_for_each(
+                m_label + " > ddc_splines_transpose_rhs",
+                exec_space(),
+                batch_domain(batched_interpolation_domain),
+                KOKKOS_LAMBDA(
+                        batch_domain_type<BatchedInterpolationDDom>::discrete_element_type const
+                                j) {
+                    for (std::size_t i = 0; i < nbasis_proxy; ++i) {
+                        spline_tr(ddc::DiscreteElement<bsplines_type>(i), j) = spline(
+                                ddc::DiscreteElement<bsplines_type>(i + offset_proxy),
+                                j);
+                    }
+                });
+    }
     // Create a 2D Kokkos::View to manage spline_tr as a matrix
     Kokkos::View<double**, Kokkos::LayoutRight, exec_space> const bcoef_section(
             spline_tr.data_handle(),
@@ -1058,17 +1088,31 @@ operator()(
     // Compute spline coef
     m_matrix->solve(bcoef_section, false);
     // Transpose back spline_tr into spline.
-    ddc::parallel_for_each(
-            m_label + " > ddc_splines_transpose_back_rhs",
-            exec_space(),
-            batch_domain(batched_interpolation_domain),
-            KOKKOS_LAMBDA(
-                    batch_domain_type<BatchedInterpolationDDom>::discrete_element_type const j) {
-                for (std::size_t i = 0; i < nbasis_proxy; ++i) {
-                    spline(ddc::DiscreteElement<bsplines_type>(i + offset_proxy), j)
-                            = spline_tr(ddc::DiscreteElement<bsplines_type>(i), j);
-                }
-            });
+    if (is_small_batch) {
+        ddc::parallel_for_each(
+                m_label + " > ddc_splines_transpose_back_rhs",
+                exec_space(),
+                transpose_domain,
+                KOKKOS_LAMBDA(transpose_element_type const e) {
+                    ddc::DiscreteElement<bsplines_type> const i(e);
+                    spline(i + offset_proxy,
+                           batch_domain_type<BatchedInterpolationDDom>::discrete_element_type(e))
+                            = spline_tr(e);
+                });
+    } else {
+        ddc::parallel_for_each(
+                m_label + " > ddc_splines_transpose_back_rhs",
+                exec_space(),
+                batch_domain(batched_interpolation_domain),
+                KOKKOS_LAMBDA(
+                        batch_domain_type<BatchedInterpolationDDom>::discrete_element_type const
+                                j) {
+                    for (std::size_t i = 0; i < nbasis_proxy; ++i) {
+                        spline(ddc::DiscreteElement<bsplines_type>(i + offset_proxy), j)
+                                = spline_tr(ddc::DiscreteElement<bsplines_type>(i), j);
+                    }
+                });
+    }
 
     // Duplicate the lower spline coefficients to the upper side in case of periodic boundaries
     if (bsplines_type::is_periodic()) {
@@ -12,12 +12,30 @@
 
 #include <Kokkos_Core.hpp>
 
+#include "batch_parallelism.hpp"
+#include "coordinate_functor.hpp"
 #include "deriv.hpp"
 #include "integrals.hpp"
 #include "periodic_extrapolation_rule.hpp"
 
 namespace ddc {
 
+/**
+ * @brief An enum determining how a SplineEvaluator locates the coordinates of a batch line.
+ *
+ * Along a line of sorted coordinates, e.g. the feet of the characteristics of a semi-Lagrangian
+ * step, the cell of a point is found by walking the cells from the one of the previous point and
+ * the spline coefficients are only reloaded when the cell changes. Walking an unsorted line gives
+ * the same values, it only costs more steps. DETECT compares each coordinate with the previous one
+ * during the walk, so each coordinate is computed once, and locates the points following the
+ * first decrease independently.
+ */
+enum class SplineEvaluationOrder {
+    UNSORTED, ///< Enum member to locate each coordinate independently
+    SORTED, ///< Enum member to walk the cells along each batch line, the coordinates being sorted
+    DETECT ///< Enum member to walk the cells along each batch line up to its first decrease
+};
+
 /**
  * @brief A class to evaluate, differentiate or integrate a spline function.
  *
@@ -103,6 +121,23 @@ private:
 
     UpperExtrapolationRule m_upper_extrap_rule;
 
+    SplineEvaluationOrder m_evaluation_order;
+
+    double m_small_batch_threshold;
+
+    /// @brief The integrals of the B-splines on their full domain, computed by the first call to integrate.
+    mutable Kokkos::View<double*, memory_space> m_bsplines_integrals;
+
+    /// @brief The state of an evaluation along a batch line: the last cell and its coefficients.
+    struct CellSweep
+    {
+        ddc::DiscreteElement<bsplines_type> jmin;
+
+        std::array<double, bsplines_type::degree() + 1> coefs;
+
+        bool has_coefs;
+    };
+
 public:
     static_assert(
             std::is_same_v<LowerExtrapolationRule,
@@ -141,14 +176,22 @@ public:
      *
      * @param lower_extrap_rule The extrapolation rule at the lower boundary.
      * @param upper_extrap_rule The extrapolation rule at the upper boundary.
+     * @param evaluation_order How the coordinates of a batch line are located.
+     * @param small_batch_threshold The minimal gain of occupancy of the execution space for the
+     * points of a batch to be evaluated independently instead of one line per thread, see
+     * detail::is_small_batch. The lines walked with SplineEvaluationOrder::SORTED are never split.
      *
      * @see NullExtrapolationRule ConstantExtrapolationRule PeriodicExtrapolationRule
      */
     explicit SplineEvaluator(
             LowerExtrapolationRule const& lower_extrap_rule,
-            UpperExtrapolationRule const& upper_extrap_rule)
+            UpperExtrapolationRule const& upper_extrap_rule,
+            SplineEvaluationOrder const evaluation_order = SplineEvaluationOrder::DETECT,
+            double const small_batch_threshold = detail::default_small_batch_threshold)
         : m_lower_extrap_rule(lower_extrap_rule)
         , m_upper_extrap_rule(upper_extrap_rule)
+        , m_evaluation_order(evaluation_order)
+        , m_small_batch_threshold(small_batch_threshold)
     {
     }
 
@@ -213,6 +256,26 @@ public:
         return m_upper_extrap_rule;
     }
 
+    /**
+     * @brief Get the way the coordinates of a batch line are located.
+     *
+     * @return The evaluation order.
+     */
+    SplineEvaluationOrder evaluation_order() const
+    {
+        return m_evaluation_order;
+    }
+
+    /**
+     * @brief Get the minimal gain of occupancy to evaluate the points of a batch independently.
+     *
+     * @return The threshold of the small batches.
+     */
+    double small_batch_threshold() const
+    {
+        return m_small_batch_threshold;
+    }
+
     /**
      * @brief Evaluate 1D spline function (described by its spline coefficients) at a given coordinate.
      *
@@ -253,6 +316,8 @@ public:
      * points represented by this domain are unused and irrelevant (but the points themselves (DiscreteElement) are used to select
      * the set of 1D spline coefficients retained to perform the evaluation).
      * @param[in] spline_coef A ChunkSpan storing the spline coefficients.
+     *
+     * @see SplineEvaluationOrder
      */
     template <
             class Layout1,
@@ -274,23 +339,40 @@ public:
                     Layout3,
                     memory_space> const spline_coef) const
     {
-        evaluation_domain_type const evaluation_domain(spline_eval.domain());
-        batch_domain_type<BatchedInterpolationDDom> const batch_domain(spline_eval.domain());
+        evaluate_batched(spline_eval, coords_eval, spline_coef);
+    }
 
-        ddc::parallel_for_each(
-                "ddc_splines_evaluate",
-                exec_space(),
-                batch_domain,
-                KOKKOS_CLASS_LAMBDA(
-                        batch_domain_type<BatchedInterpolationDDom>::discrete_element_type const
-                                j) {
-                    auto const spline_eval_1D = spline_eval[j];
-                    auto const coords_eval_1D = coords_eval[j];
-                    auto const spline_coef_1D = spline_coef[j];
-                    for (auto const i : evaluation_domain) {
-                        spline_eval_1D(i) = eval(coords_eval_1D(i), spline_coef_1D);
-                    }
-                });
+    /**
+     * @brief Evaluate spline function (described by its spline coefficients) at coordinates computed on the fly.
+     *
+     * Same as the evaluation at coordinates stored in a ChunkSpan, the coordinate of each point being given by a
+     * functor called inside the evaluation kernel, e.g. to compute the feet of the characteristics without storing them.
+     *
+     * @param[out] spline_eval The values of the spline function at the desired coordinates. For practical reasons those are
+     * stored in a ChunkSpan defined on a batched_evaluation_domain_type.
+     * @param[in] coords_eval A functor callable on the device, returning the coordinate where the spline is evaluated for
+     * each DiscreteElement of the batched_evaluation_domain_type. Note that only the component along the dimension of
+     * interest is used.
+     * @param[in] spline_coef A ChunkSpan storing the spline coefficients.
+     *
+     * @see SplineEvaluationOrder
+     */
+    template <
+            class Layout1,
+            class Layout2,
+            class BatchedInterpolationDDom,
+            concepts::coordinate_functor<BatchedInterpolationDDom> CoordsFunctor>
+    void operator()(
+            ddc::ChunkSpan<double, BatchedInterpolationDDom, Layout1, memory_space> const
+                    spline_eval,
+            CoordsFunctor const& coords_eval,
+            ddc::ChunkSpan<
+                    double const,
+                    batched_spline_domain_type<BatchedInterpolationDDom>,
+                    Layout2,
+                    memory_space> const spline_coef) const
+    {
+        evaluate_batched(spline_eval, coords_eval, spline_coef);
     }
 
     /**
@@ -321,22 +403,132 @@ public:
                     Layout2,
                     memory_space> const spline_coef) const
     {
+        using batch_element_type
+                = batch_domain_type<BatchedInterpolationDDom>::discrete_element_type;
+
         evaluation_domain_type const evaluation_domain(spline_eval.domain());
         batch_domain_type<BatchedInterpolationDDom> const batch_domain(spline_eval.domain());
 
+        if (m_evaluation_order != SplineEvaluationOrder::SORTED
+            && detail::is_small_batch(
+                    exec_space(),
+                    batch_domain.size(),
+                    evaluation_domain.size(),
+                    m_small_batch_threshold)) {
+            ddc::parallel_for_each(
+                    "ddc_splines_evaluate",
+                    exec_space(),
+                    spline_eval.domain(),
+                    KOKKOS_CLASS_LAMBDA(BatchedInterpolationDDom::discrete_element_type const e) {
+                        ddc::Coordinate<continuous_dimension_type> const coord_eval_1D
+                                = ddc::coordinate(evaluation_domain_type::discrete_element_type(e));
+                        spline_eval(e) = eval(coord_eval_1D, spline_coef[batch_element_type(e)]);
+                    });
+            return;
+        }
+
         ddc::parallel_for_each(
                 "ddc_splines_evaluate",
                 exec_space(),
                 batch_domain,
-                KOKKOS_CLASS_LAMBDA(
-                        batch_domain_type<BatchedInterpolationDDom>::discrete_element_type const
-                                j) {
+                KOKKOS_CLASS_LAMBDA(batch_element_type const j) {
                     auto const spline_eval_1D = spline_eval[j];
                     auto const spline_coef_1D = spline_coef[j];
+                    // the points of a mesh are sorted
+                    CellSweep sweep {spline_coef_1D.domain().front(), {}, false};
+                    CellSweep* const sweep_ptr
+                            = m_evaluation_order == SplineEvaluationOrder::UNSORTED ? nullptr
+                                                                                    : &sweep;
                     for (auto const i : evaluation_domain) {
                         ddc::Coordinate<continuous_dimension_type> coord_eval_1D
                                 = ddc::coordinate(i);
-                        spline_eval_1D(i) = eval(coord_eval_1D, spline_coef_1D);
+                        spline_eval_1D(i) = eval(coord_eval_1D, spline_coef_1D, sweep_ptr);
+                    }
+                });
+    }
+
+    /**
+     * @brief Evaluate a spline function (described by its spline coefficients) on a mesh shifted by a constant
+     * displacement.
+     *
+     * The spline is evaluated at `ddc::coordinate(i) - shift` for every point i of the mesh, as for a constant
+     * velocity advection. This is a batched 1D evaluation, see the operator() on a mesh.
+     *
+     * When the B-splines are uniform and the evaluation mesh is uniform with the step of the B-splines, all
+     * the shifted points have the same position in their cell. The values of the B-splines are then computed
+     * once and the evaluation is a (degree+1)-point stencil over the spline coefficients. The points whose
+     * cell is outside a non-periodic domain are evaluated individually with the extrapolation rules, as are
+     * all the points in the other cases.
+     *
+     * @param[out] spline_eval The values of the spline function at the shifted coordinates of the mesh.
+     * @param[in] shift The displacement subtracted from the coordinates of the mesh.
+     * @param[in] spline_coef A ChunkSpan storing the spline coefficients.
+     */
+    template <class Layout1, class Layout2, class BatchedInterpolationDDom>
+    void eval_shifted(
+            ddc::ChunkSpan<double, BatchedInterpolationDDom, Layout1, memory_space> const
+                    spline_eval,
+            double const shift,
+            ddc::ChunkSpan<
+                    double const,
+                    batched_spline_domain_type<BatchedInterpolationDDom>,
+                    Layout2,
+                    memory_space> const spline_coef) const
+    {
+        evaluation_domain_type const evaluation_domain(spline_eval.domain());
+        if (evaluation_domain.empty()) {
+            return;
+        }
+
+        if constexpr (
+                is_uniform_bsplines_v<bsplines_type>
+                && is_uniform_point_sampling_v<evaluation_discrete_dimension_type>) {
+            auto const& bsplines = ddc::host_discrete_space<bsplines_type>();
+            double const step = bsplines.length() / bsplines.ncells();
+            if (Kokkos::abs(ddc::step<evaluation_discrete_dimension_type>() - step)
+                <= step * 1e-14) {
+                eval_shifted_stencil(spline_eval, shift, spline_coef);
+                return;
+            }
+        }
+
+        using batch_element_type
+                = batch_domain_type<BatchedInterpolationDDom>::discrete_element_type;
+        batch_domain_type<BatchedInterpolationDDom> const batch_domain(spline_eval.domain());
+
+        if (m_evaluation_order != SplineEvaluationOrder::SORTED
+            && detail::is_small_batch(
+                    exec_space(),
+                    batch_domain.size(),
+                    evaluation_domain.size(),
+                    m_small_batch_threshold)) {
+            ddc::parallel_for_each(
+                    "ddc_splines_evaluate_shifted",
+                    exec_space(),
+                    spline_eval.domain(),
+                    KOKKOS_CLASS_LAMBDA(BatchedInterpolationDDom::discrete_element_type const e) {
+                        ddc::Coordinate<continuous_dimension_type> const coord_eval_1D(
+                                double(ddc::coordinate(
+                                        evaluation_domain_type::discrete_element_type(e)))
+                                - shift);
+                        spline_eval(e) = eval(coord_eval_1D, spline_coef[batch_element_type(e)]);
+                    });
+            return;
+        }
+
+        ddc::parallel_for_each(
+                "ddc_splines_evaluate_shifted",
+                exec_space(),
+                batch_domain,
+                KOKKOS_CLASS_LAMBDA(batch_element_type const j) {
+                    auto const spline_eval_1D = spline_eval[j];
+                    auto const spline_coef_1D = spline_coef[j];
+                    // the shifted points of a mesh are sorted
+                    CellSweep sweep {spline_coef_1D.domain().front(), {}, false};
+                    for (auto const i : evaluation_domain) {
+                        ddc::Coordinate<continuous_dimension_type> const coord_eval_1D(
+                                double(ddc::coordinate(i)) - shift);
+                        spline_eval_1D(i) = eval(coord_eval_1D, spline_coef_1D, &sweep);
                     }
                 });
     }
@@ -409,16 +601,35 @@ public:
     {
         static_assert(is_discrete_element_v<DElem>);
 
+        using batch_element_type
+                = batch_domain_type<BatchedInterpolationDDom>::discrete_element_type;
+
         evaluation_domain_type const evaluation_domain(spline_eval.domain());
         batch_domain_type<BatchedInterpolationDDom> const batch_domain(spline_eval.domain());
 
+        if (detail::is_small_batch(
+                    exec_space(),
+                    batch_domain.size(),
+                    evaluation_domain.size(),
+                    m_small_batch_threshold)) {
+            ddc::parallel_for_each(
+                    "ddc_splines_differentiate",
+                    exec_space(),
+                    spline_eval.domain(),
+                    KOKKOS_CLASS_LAMBDA(BatchedInterpolationDDom::discrete_element_type const e) {
+                        spline_eval(e) = eval_no_bc(
+                                deriv_order,
+                                coords_eval(e),
+                                spline_coef[batch_element_type(e)]);
+                    });
+            return;
+        }
+
         ddc::parallel_for_each(
                 "ddc_splines_differentiate",
                 exec_space(),
                 batch_domain,
-                KOKKOS_CLASS_LAMBDA(
-                        batch_domain_type<BatchedInterpolationDDom>::discrete_element_type const
-                                j) {
+                KOKKOS_CLASS_LAMBDA(batch_element_type const j) {
                     auto const spline_eval_1D = spline_eval[j];
                     auto const coords_eval_1D = coords_eval[j];
                     auto const spline_coef_1D = spline_coef[j];
@@ -457,16 +668,37 @@ public:
     {
         static_assert(is_discrete_element_v<DElem>);
 
+        using batch_element_type
+                = batch_domain_type<BatchedInterpolationDDom>::discrete_element_type;
+
         evaluation_domain_type const evaluation_domain(spline_eval.domain());
         batch_domain_type<BatchedInterpolationDDom> const batch_domain(spline_eval.domain());
 
+        if (detail::is_small_batch(
+                    exec_space(),
+                    batch_domain.size(),
+                    evaluation_domain.size(),
+                    m_small_batch_threshold)) {
+            ddc::parallel_for_each(
+                    "ddc_splines_differentiate",
+                    exec_space(),
+                    spline_eval.domain(),
+                    KOKKOS_CLASS_LAMBDA(BatchedInterpolationDDom::discrete_element_type const e) {
+                        ddc::Coordinate<continuous_dimension_type> const coord_eval_1D
+                                = ddc::coordinate(evaluation_domain_type::discrete_element_type(e));
+                        spline_eval(e) = eval_no_bc(
+                                deriv_order,
+                                coord_eval_1D,
+                                spline_coef[batch_element_type(e)]);
+                    });
+            return;
+        }
+
         ddc::parallel_for_each(
                 "ddc_splines_differentiate",
                 exec_space(),
                 batch_domain,
-                KOKKOS_CLASS_LAMBDA(
-                        batch_domain_type<BatchedInterpolationDDom>::discrete_element_type const
-                                j) {
+                KOKKOS_CLASS_LAMBDA(batch_element_type const j) {
                     auto const spline_eval_1D = spline_eval[j];
                     auto const spline_coef_1D = spline_coef[j];
                     for (auto const i : evaluation_domain) {
@@ -485,6 +717,8 @@ public:
      * This means that for each element of integrals, the integration is performed with the 1D set of
      * spline coefficients identified by the same DiscreteElement.
      *
+     * The integrals of the B-splines are computed by the first call and kept by the evaluator for the next ones.
+     *
      * @param[out] integrals The integrals of the spline function on the subdomain of batch_domain. For practical reasons those are
      * stored in a ChunkSpan defined on a batch_domain_type. Note that the coordinates of the
      * points represented by this domain are unused and irrelevant.
@@ -504,33 +738,196 @@ public:
                 std::is_same_v<batch_domain_type, BatchedDDom>,
                 "The integrals domain must only contain the batch dimensions");
 
+        using batch_element_type = BatchedDDom::discrete_element_type;
+        using member_type = Kokkos::TeamPolicy<exec_space>::member_type;
+
         BatchedDDom const batch_domain(integrals.domain());
-        ddc::Chunk values_alloc(
-                "values (ddc::SplineEvaluator::integrate)",
-                ddc::DiscreteDomain<bsplines_type>(spline_coef.domain()),
-                ddc::KokkosAllocator<double, memory_space>());
-        ddc::ChunkSpan const values = values_alloc.span_view();
-        ddc::integrals(exec_space(), values);
+        [[maybe_unused]] std::array const batch_extents = detail::array(batch_domain.extents());
+        ddc::DiscreteDomain<bsplines_type> const bsplines_domain(spline_coef.domain());
+        ddc::DiscreteElement<bsplines_type> const bsplines_front
+                = ddc::host_discrete_space<bsplines_type>().full_domain().front();
+        Kokkos::View<double const*, memory_space> const values = bsplines_integrals();
 
-        ddc::parallel_for_each(
+        // One team per batch element, the dot product being reduced over the threads and the
+        // vector lanes of the team
+        Kokkos::parallel_for(
                 "ddc_splines_integrate",
+                Kokkos::TeamPolicy<exec_space>(exec_space(), batch_domain.size(), Kokkos::AUTO),
+                KOKKOS_LAMBDA(member_type const& team) {
+                    batch_element_type j;
+                    if constexpr (BatchedDDom::rank() != 0) {
+                        j = detail::team_unravel_index(
+                                batch_domain,
+                                batch_extents,
+                                team.league_rank());
+                    }
+                    double const integral = ddc::team_transform_reduce(
+                            team,
+                            bsplines_domain,
+                            0.,
+                            ddc::reducer::sum<double>(),
+                            [&](ddc::DiscreteElement<bsplines_type> const i) {
+                                return spline_coef(i, j) * values((i - bsplines_front).value());
+                            });
+                    Kokkos::single(Kokkos::PerTeam(team), [&]() { integrals(j) = integral; });
+                });
+    }
+
+private:
+    /// Returns the integrals of the B-splines, computing them on the first call
+    Kokkos::View<double const*, memory_space> bsplines_integrals() const
+    {
+        if (!m_bsplines_integrals.is_allocated()) {
+            ddc::DiscreteDomain<bsplines_type> const full_domain
+                    = ddc::host_discrete_space<bsplines_type>().full_domain();
+            Kokkos::View<double*, memory_space> const bsplines_integrals(
+                    "bsplines_integrals (ddc::SplineEvaluator::integrate)",
+                    full_domain.size());
+            ddc::integrals(
+                    exec_space(),
+                    ddc::ChunkSpan<
+                            double,
+                            ddc::DiscreteDomain<bsplines_type>,
+                            Kokkos::layout_right,
+                            memory_space>(bsplines_integrals.data(), full_domain));
+            m_bsplines_integrals = bsplines_integrals;
+        }
+        return m_bsplines_integrals;
+    }
+
+    /// Evaluates at the coordinates given by a ChunkSpan or by a functor on the batched domain
+    template <class Layout1, class Layout2, class BatchedInterpolationDDom, class CoordsEval>
+    void evaluate_batched(
+            ddc::ChunkSpan<double, BatchedInterpolationDDom, Layout1, memory_space> const
+                    spline_eval,
+            CoordsEval const& coords_eval,
+            ddc::ChunkSpan<
+                    double const,
+                    batched_spline_domain_type<BatchedInterpolationDDom>,
+                    Layout2,
+                    memory_space> const spline_coef) const
+    {
+        using batch_element_type
+                = batch_domain_type<BatchedInterpolationDDom>::discrete_element_type;
+
+        evaluation_domain_type const evaluation_domain(spline_eval.domain());
+        batch_domain_type<BatchedInterpolationDDom> const batch_domain(spline_eval.domain());
+
+        // The lines are too few to be walked one per thread, the points are evaluated
+        // independently without reusing the cell of the previous point, unless the lines are
+        // known to be sorted
+        if (m_evaluation_order != SplineEvaluationOrder::SORTED
+            && detail::is_small_batch(
+                    exec_space(),
+                    batch_domain.size(),
+                    evaluation_domain.size(),
+                    m_small_batch_threshold)) {
+            ddc::parallel_for_each(
+                    "ddc_splines_evaluate",
+                    exec_space(),
+                    spline_eval.domain(),
+                    KOKKOS_CLASS_LAMBDA(BatchedInterpolationDDom::discrete_element_type const e) {
+                        spline_eval(e) = eval(coords_eval(e), spline_coef[batch_element_type(e)]);
+                    });
+            return;
+        }
+
+        ddc::parallel_for_each(
+                "ddc_splines_evaluate",
                 exec_space(),
                 batch_domain,
-                KOKKOS_LAMBDA(BatchedDDom::discrete_element_type const j) {
-                    integrals(j) = 0;
-                    for (typename spline_domain_type::discrete_element_type const i :
-                         values.domain()) {
-                        integrals(j) += spline_coef(i, j) * values(i);
+                KOKKOS_CLASS_LAMBDA(batch_element_type const j) {
+                    auto const spline_eval_1D = spline_eval[j];
+                    auto const spline_coef_1D = spline_coef[j];
+                    CellSweep sweep {spline_coef_1D.domain().front(), {}, false};
+                    CellSweep* sweep_ptr
+                            = m_evaluation_order == SplineEvaluationOrder::UNSORTED ? nullptr
+                                                                                    : &sweep;
+                    ddc::Coordinate<continuous_dimension_type> coord_prev(0.);
+                    for (auto const i : evaluation_domain) {
+                        ddc::Coordinate<continuous_dimension_type> const coord_eval_1D(coords_eval(
+                                typename BatchedInterpolationDDom::discrete_element_type(i, j)));
+                        // from the first decrease the line is not sorted, the remaining points
+                        // are located independently
+                        if (m_evaluation_order == SplineEvaluationOrder::DETECT
+                            && i != evaluation_domain.front() && coord_eval_1D < coord_prev) {
+                            sweep_ptr = nullptr;
+                        }
+                        coord_prev = coord_eval_1D;
+                        spline_eval_1D(i) = eval(coord_eval_1D, spline_coef_1D, sweep_ptr);
                     }
                 });
     }
 
-private:
+    /// The uniform case of eval_shifted, all the points share the values of the B-splines
+    template <class Layout1, class Layout2, class BatchedInterpolationDDom>
+    void eval_shifted_stencil(
+            ddc::ChunkSpan<double, BatchedInterpolationDDom, Layout1, memory_space> const
+                    spline_eval,
+            double const shift,
+            ddc::ChunkSpan<
+                    double const,
+                    batched_spline_domain_type<BatchedInterpolationDDom>,
+                    Layout2,
+                    memory_space> const spline_coef) const
+    {
+        using batch_element_type
+                = batch_domain_type<BatchedInterpolationDDom>::discrete_element_type;
+        using evaluation_element_type = evaluation_domain_type::discrete_element_type;
+
+        evaluation_domain_type const evaluation_domain(spline_eval.domain());
+        auto const& bsplines = ddc::host_discrete_space<bsplines_type>();
+        double const step = bsplines.length() / bsplines.ncells();
+        long const ncells = bsplines.ncells();
+        ddc::DiscreteElement<bsplines_type> const jfront = bsplines.full_domain().front();
+
+        // position of the first shifted point in units of cells
+        double const position = (double(ddc::coordinate(evaluation_domain.front())) - shift
+                                 - double(bsplines.rmin()))
+                                / step;
+        double const cells_before = Kokkos::floor(position);
+        std::array<double, bsplines_type::degree() + 1> weights;
+        Kokkos::mdspan<double, Kokkos::extents<std::size_t, bsplines_type::degree() + 1>> const
+                weights_span(weights.data());
+        ddc::DiscreteElement<bsplines_type> const jfirst = bsplines.eval_basis(
+                weights_span,
+                ddc::Coordinate<continuous_dimension_type>(
+                        double(bsplines.rmin()) + (position - cells_before) * step));
+        long const icell_front = static_cast<long>(cells_before) + (jfirst - jfront).value();
+
+        ddc::parallel_for_each(
+                "ddc_splines_evaluate_shifted",
+                exec_space(),
+                spline_eval.domain(),
+                KOKKOS_CLASS_LAMBDA(BatchedInterpolationDDom::discrete_element_type const e) {
+                    evaluation_element_type const i(e);
+                    batch_element_type const j(e);
+                    long icell = icell_front + (i - evaluation_domain.front()).value();
+                    if constexpr (bsplines_type::is_periodic()) {
+                        icell = (icell % ncells + ncells) % ncells;
+                    } else {
+                        if (icell < 0 || icell >= ncells) {
+                            ddc::Coordinate<continuous_dimension_type> const coord_eval_1D(
+                                    double(ddc::coordinate(i)) - shift);
+                            spline_eval(e) = eval(coord_eval_1D, spline_coef[j]);
+                            return;
+                        }
+                    }
+                    double y = 0.0;
+                    for (std::size_t k = 0; k < bsplines_type::degree() + 1; ++k) {
+                        y += weights[k] * spline_coef(jfront + icell + k, j);
+                    }
+                    spline_eval(e) = y;
+                });
+    }
+
+    /// Evaluates at a coordinate, walking the cells from the state of the sweep if provided
     template <class Layout, class... CoordsDims>
     KOKKOS_INLINE_FUNCTION double eval(
             ddc::Coordinate<CoordsDims...> const& coord_eval,
             ddc::ChunkSpan<double const, spline_domain_type, Layout, memory_space> const
-                    spline_coef) const
+                    spline_coef,
+            CellSweep* const sweep = nullptr) const
     {
         ddc::Coordinate<continuous_dimension_type> coord_eval_interest(coord_eval);
         if constexpr (bsplines_type::is_periodic()) {
@@ -550,9 +947,46 @@ private:
                 return m_upper_extrap_rule(coord_eval_interest, spline_coef);
             }
         }
+        if (sweep != nullptr) {
+            return eval_near(coord_eval_interest, spline_coef, *sweep);
+        }
         return eval_no_bc(ddc::DiscreteElement<>(), coord_eval_interest, spline_coef);
     }
 
+    template <class Layout>
+    KOKKOS_INLINE_FUNCTION double eval_near(
+            ddc::Coordinate<continuous_dimension_type> const& coord_eval_interest,
+            ddc::ChunkSpan<double const, spline_domain_type, Layout, memory_space> const
+                    spline_coef,
+            CellSweep& sweep) const
+    {
+        ddc::LocalChunk<
+                double,
+                ddc::StaticDiscreteDomain<
+                        ddc::DiscreteDomain<bsplines_type>,
+                        bsplines_type::degree() + 1>>
+                vals;
+        ddc::DiscreteElement<bsplines_type> const jmin
+                = ddc::discrete_space<bsplines_type>().eval_basis_near(
+                        vals.allocation_mdspan(),
+                        coord_eval_interest,
+                        sweep.jmin);
+        // consecutive points in the same cell share their coefficients
+        if (!sweep.has_coefs || jmin != sweep.jmin) {
+            for (std::size_t i = 0; i < bsplines_type::degree() + 1; ++i) {
+                sweep.coefs[i] = spline_coef(ddc::DiscreteElement<bsplines_type>(jmin + i));
+            }
+            sweep.jmin = jmin;
+            sweep.has_coefs = true;
+        }
+
+        double y = 0.0;
+        for (std::size_t i = 0; i < bsplines_type::degree() + 1; ++i) {
+            y += sweep.coefs[i] * vals(ddc::DiscreteVector<bsplines_type>(i));
+        }
+        return y;
+    }
+
     template <class... DerivDims, class Layout, class... CoordsDims>
     KOKKOS_INLINE_FUNCTION double eval_no_bc(
             ddc::DiscreteElement<DerivDims...> const& deriv_order,
@@ -569,37 +1003,50 @@ private:
                 "The only valid dimension for deriv_order is Deriv<Dim>");
 
         ddc::DiscreteElement<bsplines_type> jmin;
-        std::array<double, bsplines_type::degree() + 1> vals_ptr;
-        Kokkos::mdspan<double, Kokkos::extents<std::size_t, bsplines_type::degree() + 1>> const
-                vals(vals_ptr.data());
+        ddc::LocalChunk<
+                double,
+                ddc::StaticDiscreteDomain<
+                        ddc::DiscreteDomain<bsplines_type>,
+                        bsplines_type::degree() + 1>>
+                vals;
         ddc::Coordinate<continuous_dimension_type> const coord_eval_interest(coord_eval);
 
         if constexpr (sizeof...(DerivDims) == 0) {
-            jmin = ddc::discrete_space<bsplines_type>().eval_basis(vals, coord_eval_interest);
+            jmin = ddc::discrete_space<bsplines_type>()
+                           .eval_basis(vals.allocation_mdspan(), coord_eval_interest);
         } else {
             auto const order = deriv_order.uid();
             KOKKOS_ASSERT(order > 0 && order <= bsplines_type::degree())
 
-            std::array<double, (bsplines_type::degree() + 1) * (bsplines_type::degree() + 1)>
-                    derivs_ptr;
+            // sized for the highest order, only the first order + 1 columns are filled
+            ddc::LocalChunk<
+                    double,
+                    ddc::StaticDiscreteDomain<
+                            ddc::DiscreteDomain<bsplines_type, deriv_dim>,
+                            bsplines_type::degree() + 1,
+                            bsplines_type::degree() + 1>>
+                    derivs_storage;
             Kokkos::mdspan<
                     double,
                     Kokkos::extents<
                             std::size_t,
                             bsplines_type::degree() + 1,
-                            Kokkos::dynamic_extent>> const derivs(derivs_ptr.data(), order + 1);
+                            Kokkos::dynamic_extent>> const
+                    derivs(derivs_storage.data_handle(), order + 1);
 
             jmin = ddc::discrete_space<bsplines_type>()
                            .eval_basis_and_n_derivs(derivs, coord_eval_interest, order);
 
             for (std::size_t i = 0; i < bsplines_type::degree() + 1; ++i) {
-                vals[i] = DDC_MDSPAN_ACCESS_OP(derivs, i, order);
+                vals(ddc::DiscreteVector<bsplines_type>(i))
+                        = DDC_MDSPAN_ACCESS_OP(derivs, i, order);
             }
         }
 
         double y = 0.0;
         for (std::size_t i = 0; i < bsplines_type::degree() + 1; ++i) {
-            y += spline_coef(ddc::DiscreteElement<bsplines_type>(jmin + i)) * vals[i];
+            y += spline_coef(ddc::DiscreteElement<bsplines_type>(jmin + i))
+                 * vals(ddc::DiscreteVector<bsplines_type>(i));
         }
         return y;
     }
@@ -12,6 +12,7 @@
 
 #include <Kokkos_Core.hpp>
 
+#include "coordinate_functor.hpp"
 #include "deriv.hpp"
 #include "integrals.hpp"
 #include "periodic_extrapolation_rule.hpp"
@@ -489,29 +490,38 @@ public:
                     Layout3,
                     memory_space> const spline_coef) const
     {
-        batch_domain_type<BatchedInterpolationDDom> const batch_domain(coords_eval.domain());
-        evaluation_domain_type1 const evaluation_domain1(spline_eval.domain());
-        evaluation_domain_type2 const evaluation_domain2(spline_eval.domain());
-        evaluation_domain_type3 const evaluation_domain3(spline_eval.domain());
-        ddc::parallel_for_each(
-                "ddc_splines_evaluate_3d",
-                exec_space(),
-                batch_domain,
-                KOKKOS_CLASS_LAMBDA(
-                        batch_domain_type<BatchedInterpolationDDom>::discrete_element_type const
-                                j) {
-                    auto const spline_eval_3D = spline_eval[j];
-                    auto const coords_eval_3D = coords_eval[j];
-                    auto const spline_coef_3D = spline_coef[j];
-                    for (auto const i1 : evaluation_domain1) {
-                        for (auto const i2 : evaluation_domain2) {
-                            for (auto const i3 : evaluation_domain3) {
-                                spline_eval_3D(i1, i2, i3)
-                                        = eval(coords_eval_3D(i1, i2, i3), spline_coef_3D);
-                            }
-                        }
-                    }
-                });
+        evaluate_batched(spline_eval, coords_eval, spline_coef);
+    }
+
+    /**
+     * @brief Evaluate 3D spline function (described by its spline coefficients) at coordinates computed on the fly.
+     *
+     * Same as the evaluation at coordinates stored in a ChunkSpan, the coordinate of each point being given by a
+     * functor called inside the evaluation kernel, e.g. to compute the feet of the characteristics without storing them.
+     *
+     * @param[out] spline_eval The values of the 3D spline function at the desired coordinates. For practical reasons those are
+     * stored in a ChunkSpan defined on a batched_evaluation_domain_type.
+     * @param[in] coords_eval A functor callable on the device, returning the coordinate where the spline is evaluated for
+     * each DiscreteElement of the batched_evaluation_domain_type. Note that only the components along the dimensions of
+     * interest are used.
+     * @param[in] spline_coef A ChunkSpan storing the 3D spline coefficients.
+     */
+    template <
+            class Layout1,
+            class Layout2,
+            class BatchedInterpolationDDom,
+            concepts::coordinate_functor<BatchedInterpolationDDom> CoordsFunctor>
+    void operator()(
+            ddc::ChunkSpan<double, BatchedInterpolationDDom, Layout1, memory_space> const
+                    spline_eval,
+            CoordsFunctor const& coords_eval,
+            ddc::ChunkSpan<
+                    double const,
+                    batched_spline_domain_type<BatchedInterpolationDDom>,
+                    Layout2,
+                    memory_space> const spline_coef) const
+    {
+        evaluate_batched(spline_eval, coords_eval, spline_coef);
     }
 
     /**
@@ -725,6 +735,164 @@ public:
                 });
     }
 
+    /**
+     * @brief Evaluate 3D spline function (described by its spline coefficients) and its gradient at a given coordinate.
+     *
+     * The B-splines and their first derivatives are evaluated once along each dimension and contracted with the spline
+     * coefficients in a single pass, instead of once per call to operator() and deriv().
+     *
+     * As in deriv(), the coordinate must be inside the domain along the non-periodic dimensions: the extrapolation
+     * rules only define the value of the spline, not its derivatives. It is brought back into the domain along the
+     * periodic dimensions.
+     *
+     * @param coord_eval The coordinate where the spline is evaluated. Note that only the components along the dimensions of interest are used.
+     * @param spline_coef A ChunkSpan storing the 3D spline coefficients.
+     *
+     * @return The value of the spline function followed by its derivatives along the first, the second and the third dimensions.
+     */
+    template <class Layout, class... CoordsDims>
+    KOKKOS_FUNCTION std::array<double, 4> eval_with_gradient(
+            ddc::Coordinate<CoordsDims...> const& coord_eval,
+            ddc::ChunkSpan<double const, spline_domain_type, Layout, memory_space> const
+                    spline_coef) const
+    {
+        auto const partial_derivs = eval_partial_derivs<1>(coord_eval, spline_coef);
+        return {partial_derivs[0][0][0],
+                partial_derivs[1][0][0],
+                partial_derivs[0][1][0],
+                partial_derivs[0][0][1]};
+    }
+
+    /**
+     * @brief Evaluate 3D spline function (described by its spline coefficients), its gradient and its Hessian at a given coordinate.
+     *
+     * Same as eval_with_gradient, the second derivatives being obtained from the same evaluation of the B-splines. They are
+     * zero along a dimension of degree 1.
+     *
+     * @param coord_eval The coordinate where the spline is evaluated. Note that only the components along the dimensions of interest are used.
+     * @param spline_coef A ChunkSpan storing the 3D spline coefficients.
+     *
+     * @return The value of the spline function, its derivatives along the first, the second and the third dimensions, then
+     * the second derivatives along (Dim1, Dim1), (Dim1, Dim2), (Dim1, Dim3), (Dim2, Dim2), (Dim2, Dim3) and (Dim3, Dim3).
+     */
+    template <class Layout, class... CoordsDims>
+    KOKKOS_FUNCTION std::array<double, 10> eval_with_hessian(
+            ddc::Coordinate<CoordsDims...> const& coord_eval,
+            ddc::ChunkSpan<double const, spline_domain_type, Layout, memory_space> const
+                    spline_coef) const
+    {
+        auto const partial_derivs = eval_partial_derivs<2>(coord_eval, spline_coef);
+        return {partial_derivs[0][0][0],
+                partial_derivs[1][0][0],
+                partial_derivs[0][1][0],
+                partial_derivs[0][0][1],
+                partial_derivs[2][0][0],
+                partial_derivs[1][1][0],
+                partial_derivs[1][0][1],
+                partial_derivs[0][2][0],
+                partial_derivs[0][1][1],
+                partial_derivs[0][0][2]};
+    }
+
+    /**
+     * @brief Evaluate 3D spline function (described by its spline coefficients) and its gradient on a mesh.
+     *
+     * This is a batched 3D evaluation, computing the values and the three derivatives of the spline function in a single
+     * kernel. The boundaries are handled as in the single coordinate eval_with_gradient.
+     *
+     * @param[out] spline_eval The values of the 3D spline function at the desired coordinates.
+     * @param[out] spline_eval_deriv1 The derivatives of the 3D spline function along the first dimension at the desired coordinates.
+     * @param[out] spline_eval_deriv2 The derivatives of the 3D spline function along the second dimension at the desired coordinates.
+     * @param[out] spline_eval_deriv3 The derivatives of the 3D spline function along the third dimension at the desired coordinates.
+     * @param[in] coords_eval The coordinates where the spline is evaluated. Those are
+     * stored in a ChunkSpan defined on a batched_evaluation_domain_type.
+     * @param[in] spline_coef A ChunkSpan storing the 3D spline coefficients.
+     */
+    template <
+            class Layout1,
+            class Layout2,
+            class Layout3,
+            class Layout4,
+            class Layout5,
+            class Layout6,
+            class BatchedInterpolationDDom,
+            class... CoordsDims>
+    void eval_with_gradient(
+            ddc::ChunkSpan<double, BatchedInterpolationDDom, Layout1, memory_space> const
+                    spline_eval,
+            ddc::ChunkSpan<double, BatchedInterpolationDDom, Layout2, memory_space> const
+                    spline_eval_deriv1,
+            ddc::ChunkSpan<double, BatchedInterpolationDDom, Layout3, memory_space> const
+                    spline_eval_deriv2,
+            ddc::ChunkSpan<double, BatchedInterpolationDDom, Layout4, memory_space> const
+                    spline_eval_deriv3,
+            ddc::ChunkSpan<
+                    ddc::Coordinate<CoordsDims...> const,
+                    BatchedInterpolationDDom,
+                    Layout5,
+                    memory_space> const coords_eval,
+            ddc::ChunkSpan<
+                    double const,
+                    batched_spline_domain_type<BatchedInterpolationDDom>,
+                    Layout6,
+                    memory_space> const spline_coef) const
+    {
+        evaluate_gradient_batched(
+                spline_eval,
+                spline_eval_deriv1,
+                spline_eval_deriv2,
+                spline_eval_deriv3,
+                coords_eval,
+                spline_coef);
+    }
+
+    /**
+     * @brief Evaluate 3D spline function (described by its spline coefficients) and its gradient at coordinates computed on the fly.
+     *
+     * Same as the evaluation at coordinates stored in a ChunkSpan, the coordinate of each point being given by a
+     * functor called inside the evaluation kernel.
+     *
+     * @param[out] spline_eval The values of the 3D spline function at the desired coordinates.
+     * @param[out] spline_eval_deriv1 The derivatives of the 3D spline function along the first dimension at the desired coordinates.
+     * @param[out] spline_eval_deriv2 The derivatives of the 3D spline function along the second dimension at the desired coordinates.
+     * @param[out] spline_eval_deriv3 The derivatives of the 3D spline function along the third dimension at the desired coordinates.
+     * @param[in] coords_eval A functor callable on the device, returning the coordinate where the spline is evaluated for
+     * each DiscreteElement of the batched_evaluation_domain_type.
+     * @param[in] spline_coef A ChunkSpan storing the 3D spline coefficients.
+     */
+    template <
+            class Layout1,
+            class Layout2,
+            class Layout3,
+            class Layout4,
+            class Layout5,
+            class BatchedInterpolationDDom,
+            concepts::coordinate_functor<BatchedInterpolationDDom> CoordsFunctor>
+    void eval_with_gradient(
+            ddc::ChunkSpan<double, BatchedInterpolationDDom, Layout1, memory_space> const
+                    spline_eval,
+            ddc::ChunkSpan<double, BatchedInterpolationDDom, Layout2, memory_space> const
+                    spline_eval_deriv1,
+            ddc::ChunkSpan<double, BatchedInterpolationDDom, Layout3, memory_space> const
+                    spline_eval_deriv2,
+            ddc::ChunkSpan<double, BatchedInterpolationDDom, Layout4, memory_space> const
+                    spline_eval_deriv3,
+            CoordsFunctor const& coords_eval,
+            ddc::ChunkSpan<
+                    double const,
+                    batched_spline_domain_type<BatchedInterpolationDDom>,
+                    Layout5,
+                    memory_space> const spline_coef) const
+    {
+        evaluate_gradient_batched(
+                spline_eval,
+                spline_eval_deriv1,
+                spline_eval_deriv2,
+                spline_eval_deriv3,
+                coords_eval,
+                spline_coef);
+    }
+
     /** @brief Perform batched 3D integrations of a spline function (described by its spline coefficients) along the dimensions of interest and store results on a subdomain of batch_domain.
      *
      * The spline coefficients represent a 3D spline function defined on a B-splines (basis splines). They can be obtained via various methods, such as using a SplineBuilder3D.
@@ -796,26 +964,106 @@ public:
     }
 
 private:
-    /**
-     * @brief Evaluate the function on B-splines at the coordinate given.
-     *
-     * This function firstly deals with the boundary conditions and calls the SplineEvaluator3D::eval_no_bc function
-     * to evaluate.
-     *
-     * @param[in] coord_eval The 3D coordinate where we want to evaluate.
-     * @param[in] spline_coef The B-splines coefficients of the function we want to evaluate.
-     * @param[out] vals1 A ChunkSpan with the not-null values of each function of the spline in the first dimension.
-     * @param[out] vals2 A ChunkSpan with the not-null values of each function of the spline in the second dimension.
-     *
-     * @return A double with the value of the function at the coordinate given.
-     *
-     * @see SplineBoundaryValue
-     */
-    template <class Layout, class... CoordsDims>
-    KOKKOS_INLINE_FUNCTION double eval(
-            ddc::Coordinate<CoordsDims...> coord_eval,
-            ddc::ChunkSpan<double const, spline_domain_type, Layout, memory_space> const
-                    spline_coef) const
+    /// Evaluates at the coordinates given by a ChunkSpan or by a functor on the batched domain
+    template <class Layout1, class Layout2, class BatchedInterpolationDDom, class CoordsEval>
+    void evaluate_batched(
+            ddc::ChunkSpan<double, BatchedInterpolationDDom, Layout1, memory_space> const
+                    spline_eval,
+            CoordsEval const& coords_eval,
+            ddc::ChunkSpan<
+                    double const,
+                    batched_spline_domain_type<BatchedInterpolationDDom>,
+                    Layout2,
+                    memory_space> const spline_coef) const
+    {
+        using batched_element_type = BatchedInterpolationDDom::discrete_element_type;
+        batch_domain_type<BatchedInterpolationDDom> const batch_domain(spline_eval.domain());
+        evaluation_domain_type1 const evaluation_domain1(spline_eval.domain());
+        evaluation_domain_type2 const evaluation_domain2(spline_eval.domain());
+        evaluation_domain_type3 const evaluation_domain3(spline_eval.domain());
+        ddc::parallel_for_each(
+                "ddc_splines_evaluate_3d",
+                exec_space(),
+                batch_domain,
+                KOKKOS_CLASS_LAMBDA(
+                        batch_domain_type<BatchedInterpolationDDom>::discrete_element_type const
+                                j) {
+                    auto const spline_eval_3D = spline_eval[j];
+                    auto const spline_coef_3D = spline_coef[j];
+                    for (auto const i1 : evaluation_domain1) {
+                        for (auto const i2 : evaluation_domain2) {
+                            for (auto const i3 : evaluation_domain3) {
+                                spline_eval_3D(i1, i2, i3)
+                                        = eval(coords_eval(batched_element_type(i1, i2, i3, j)),
+                                               spline_coef_3D);
+                            }
+                        }
+                    }
+                });
+    }
+
+    /// Evaluates the values and the gradients at the coordinates given by a ChunkSpan or by a functor on the batched domain
+    template <
+            class Layout1,
+            class Layout2,
+            class Layout3,
+            class Layout4,
+            class Layout5,
+            class BatchedInterpolationDDom,
+            class CoordsEval>
+    void evaluate_gradient_batched(
+            ddc::ChunkSpan<double, BatchedInterpolationDDom, Layout1, memory_space> const
+                    spline_eval,
+            ddc::ChunkSpan<double, BatchedInterpolationDDom, Layout2, memory_space> const
+                    spline_eval_deriv1,
+            ddc::ChunkSpan<double, BatchedInterpolationDDom, Layout3, memory_space> const
+                    spline_eval_deriv2,
+            ddc::ChunkSpan<double, BatchedInterpolationDDom, Layout4, memory_space> const
+                    spline_eval_deriv3,
+            CoordsEval const& coords_eval,
+            ddc::ChunkSpan<
+                    double const,
+                    batched_spline_domain_type<BatchedInterpolationDDom>,
+                    Layout5,
+                    memory_space> const spline_coef) const
+    {
+        using batched_element_type = BatchedInterpolationDDom::discrete_element_type;
+        batch_domain_type<BatchedInterpolationDDom> const batch_domain(spline_eval.domain());
+        evaluation_domain_type1 const evaluation_domain1(spline_eval.domain());
+        evaluation_domain_type2 const evaluation_domain2(spline_eval.domain());
+        evaluation_domain_type3 const evaluation_domain3(spline_eval.domain());
+        ddc::parallel_for_each(
+                "ddc_splines_evaluate_gradient_3d",
+                exec_space(),
+                batch_domain,
+                KOKKOS_CLASS_LAMBDA(
+                        batch_domain_type<BatchedInterpolationDDom>::discrete_element_type const
+                                j) {
+                    auto const spline_eval_3D = spline_eval[j];
+                    auto const spline_eval_deriv1_3D = spline_eval_deriv1[j];
+                    auto const spline_eval_deriv2_3D = spline_eval_deriv2[j];
+                    auto const spline_eval_deriv3_3D = spline_eval_deriv3[j];
+                    auto const spline_coef_3D = spline_coef[j];
+                    for (auto const i1 : evaluation_domain1) {
+                        for (auto const i2 : evaluation_domain2) {
+                            for (auto const i3 : evaluation_domain3) {
+                                std::array<double, 4> const values = eval_with_gradient(
+                                        coords_eval(batched_element_type(i1, i2, i3, j)),
+                                        spline_coef_3D);
+                                spline_eval_3D(i1, i2, i3) = values[0];
+                                spline_eval_deriv1_3D(i1, i2, i3) = values[1];
+                                spline_eval_deriv2_3D(i1, i2, i3) = values[2];
+                                spline_eval_deriv3_3D(i1, i2, i3) = values[3];
+                            }
+                        }
+                    }
+                });
+    }
+
+    /// Brings the coordinate back into the domain along the periodic dimensions
+    template <class... CoordsDims>
+    KOKKOS_INLINE_FUNCTION static void wrap_periodic_coord(
+            ddc::Coordinate<CoordsDims...>& coord_eval)
     {
         using Dim1 = continuous_dimension_type1;
         using Dim2 = continuous_dimension_type2;
@@ -853,6 +1101,33 @@ private:
                            * ddc::discrete_space<bsplines_type3>().length();
             }
         }
+    }
+
+    /**
+     * @brief Evaluate the function on B-splines at the coordinate given.
+     *
+     * This function firstly deals with the boundary conditions and calls the SplineEvaluator3D::eval_no_bc function
+     * to evaluate.
+     *
+     * @param[in] coord_eval The 3D coordinate where we want to evaluate.
+     * @param[in] spline_coef The B-splines coefficients of the function we want to evaluate.
+     * @param[out] vals1 A ChunkSpan with the not-null values of each function of the spline in the first dimension.
+     * @param[out] vals2 A ChunkSpan with the not-null values of each function of the spline in the second dimension.
+     *
+     * @return A double with the value of the function at the coordinate given.
+     *
+     * @see SplineBoundaryValue
+     */
+    template <class Layout, class... CoordsDims>
+    KOKKOS_INLINE_FUNCTION double eval(
+            ddc::Coordinate<CoordsDims...> coord_eval,
+            ddc::ChunkSpan<double const, spline_domain_type, Layout, memory_space> const
+                    spline_coef) const
+    {
+        using Dim1 = continuous_dimension_type1;
+        using Dim2 = continuous_dimension_type2;
+        using Dim3 = continuous_dimension_type3;
+        wrap_periodic_coord(coord_eval);
         if constexpr (!bsplines_type1::is_periodic()) {
             if (ddc::get<Dim1>(coord_eval) < ddc::discrete_space<bsplines_type1>().rmin()) {
                 return m_lower_extrap_rule_1(coord_eval, spline_coef);
@@ -889,6 +1164,142 @@ private:
                 spline_coef);
     }
 
+    /**
+     * @brief Evaluate the function and its partial derivatives up to a given total order at the coordinate given.
+     *
+     * This function brings the coordinate back into the domain along the periodic dimensions and calls
+     * SplineEvaluator3D::eval_partial_derivs_no_bc. As in deriv(), the coordinate must be inside the domain along the
+     * non-periodic dimensions, the extrapolation rules only defining the value of the spline.
+     *
+     * @param[in] coord_eval The coordinate where we want to evaluate.
+     * @param[in] spline_coef The B-splines coefficients of the function we want to evaluate.
+     *
+     * @return The partial derivatives indexed by their orders along each dimension.
+     */
+    template <std::size_t MaxOrder, class Layout, class... CoordsDims>
+    KOKKOS_INLINE_FUNCTION std::array<
+            std::array<std::array<double, MaxOrder + 1>, MaxOrder + 1>,
+            MaxOrder + 1>
+    eval_partial_derivs(
+            ddc::Coordinate<CoordsDims...> coord_eval,
+            ddc::ChunkSpan<double const, spline_domain_type, Layout, memory_space> const
+                    spline_coef) const
+    {
+        using Dim1 = continuous_dimension_type1;
+        using Dim2 = continuous_dimension_type2;
+        using Dim3 = continuous_dimension_type3;
+        wrap_periodic_coord(coord_eval);
+        return eval_partial_derivs_no_bc<MaxOrder>(
+                ddc::Coordinate<
+                        continuous_dimension_type1,
+                        continuous_dimension_type2,
+                        continuous_dimension_type3>(
+                        ddc::get<Dim1>(coord_eval),
+                        ddc::get<Dim2>(coord_eval),
+                        ddc::get<Dim3>(coord_eval)),
+                spline_coef);
+    }
+
+    /**
+     * @brief Evaluate the function and its partial derivatives up to a given total order at the coordinate given.
+     *
+     * The B-splines and their derivatives are evaluated once along each dimension and contracted with the coefficients in
+     * a single pass.
+     *
+     * @param[in] coord_eval The coordinate where we want to evaluate.
+     * @param[in] spline_coef The B-splines coefficients of the function we want to evaluate.
+     *
+     * @return The partial derivatives indexed by their orders along each dimension, those of total order greater than
+     * MaxOrder being zero.
+     */
+    template <std::size_t MaxOrder, class Layout, class... CoordsDims>
+    KOKKOS_INLINE_FUNCTION std::array<
+            std::array<std::array<double, MaxOrder + 1>, MaxOrder + 1>,
+            MaxOrder + 1>
+    eval_partial_derivs_no_bc(
+            ddc::Coordinate<CoordsDims...> const& coord_eval,
+            ddc::ChunkSpan<double const, spline_domain_type, Layout, memory_space> const
+                    spline_coef) const
+    {
+        using deriv_dim1 = ddc::Deriv<continuous_dimension_type1>;
+        using deriv_dim2 = ddc::Deriv<continuous_dimension_type2>;
+        using deriv_dim3 = ddc::Deriv<continuous_dimension_type3>;
+        using deriv_index1 = ddc::DiscreteVector<bsplines_type1, deriv_dim1>;
+        using deriv_index2 = ddc::DiscreteVector<bsplines_type2, deriv_dim2>;
+        using deriv_index3 = ddc::DiscreteVector<bsplines_type3, deriv_dim3>;
+
+        // The derivatives of order greater than the degree are zero
+        constexpr std::size_t order1
+                = MaxOrder < bsplines_type1::degree() ? MaxOrder : bsplines_type1::degree();
+        constexpr std::size_t order2
+                = MaxOrder < bsplines_type2::degree() ? MaxOrder : bsplines_type2::degree();
+        constexpr std::size_t order3
+                = MaxOrder < bsplines_type3::degree() ? MaxOrder : bsplines_type3::degree();
+
+        ddc::LocalChunk<
+                double,
+                ddc::StaticDiscreteDomain<
+                        ddc::DiscreteDomain<bsplines_type1, deriv_dim1>,
+                        bsplines_type1::degree() + 1,
+                        order1 + 1>>
+                derivs1;
+        ddc::LocalChunk<
+                double,
+                ddc::StaticDiscreteDomain<
+                        ddc::DiscreteDomain<bsplines_type2, deriv_dim2>,
+                        bsplines_type2::degree() + 1,
+                        order2 + 1>>
+                derivs2;
+        ddc::LocalChunk<
+                double,
+                ddc::StaticDiscreteDomain<
+                        ddc::DiscreteDomain<bsplines_type3, deriv_dim3>,
+                        bsplines_type3::degree() + 1,
+                        order3 + 1>>
+                derivs3;
+
+        ddc::DiscreteElement<bsplines_type1> const jmin1
+                = ddc::discrete_space<bsplines_type1>().eval_basis_and_n_derivs(
+                        derivs1.allocation_mdspan(),
+                        ddc::Coordinate<continuous_dimension_type1>(coord_eval),
+                        order1);
+        ddc::DiscreteElement<bsplines_type2> const jmin2
+                = ddc::discrete_space<bsplines_type2>().eval_basis_and_n_derivs(
+                        derivs2.allocation_mdspan(),
+                        ddc::Coordinate<continuous_dimension_type2>(coord_eval),
+                        order2);
+        ddc::DiscreteElement<bsplines_type3> const jmin3
+                = ddc::discrete_space<bsplines_type3>().eval_basis_and_n_derivs(
+                        derivs3.allocation_mdspan(),
+                        ddc::Coordinate<continuous_dimension_type3>(coord_eval),
+                        order3);
+
+        std::array<std::array<std::array<double, MaxOrder + 1>, MaxOrder + 1>, MaxOrder + 1>
+                partial_derivs {};
+        for (std::size_t i = 0; i < bsplines_type1::degree() + 1; ++i) {
+            for (std::size_t j = 0; j < bsplines_type2::degree() + 1; ++j) {
+                for (std::size_t k = 0; k < bsplines_type3::degree() + 1; ++k) {
+                    double const coef = spline_coef(
+                            ddc::DiscreteElement<
+                                    bsplines_type1,
+                                    bsplines_type2,
+                                    bsplines_type3>(jmin1 + i, jmin2 + j, jmin3 + k));
+                    for (std::size_t k1 = 0; k1 < order1 + 1; ++k1) {
+                        for (std::size_t k2 = 0; k2 < order2 + 1 && k1 + k2 <= MaxOrder; ++k2) {
+                            double const coef12 = coef * derivs1(deriv_index1(i, k1))
+                                                  * derivs2(deriv_index2(j, k2));
+                            for (std::size_t k3 = 0; k3 < order3 + 1 && k1 + k2 + k3 <= MaxOrder;
+                                 ++k3) {
+                                partial_derivs[k1][k2][k3] += coef12 * derivs3(deriv_index3(k, k3));
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        return partial_derivs;
+    }
+
     /**
      * @brief Evaluate the function or its derivative at the coordinate given.
      *
@@ -14,6 +14,7 @@
 
 #include <Kokkos_Core.hpp>
 
+#include "coordinate_functor.hpp"
 #include "deriv.hpp"
 #include "integrals.hpp"
 #include "periodic_extrapolation_rule.hpp"
@@ -354,27 +355,38 @@ public:
                     Layout3,
                     memory_space> const spline_coef) const
     {
-        using evaluation_domain_type = ddc::DiscreteDomain<EvaluationDDim...>;
-        evaluation_domain_type const evaluation_domain(spline_eval.domain());
-
-        batch_domain_type<BatchedInterpolationDDom> const batch_domain(coords_eval.domain());
+        evaluate_batched(spline_eval, coords_eval, spline_coef);
+    }
 
-        ddc::parallel_for_each(
-                "ddc_splines_evaluate_Nd",
-                exec_space(),
-                batch_domain,
-                KOKKOS_CLASS_LAMBDA(
-                        batch_domain_type<BatchedInterpolationDDom>::discrete_element_type const
-                                j) {
-                    auto const spline_eval_ND = spline_eval[j];
-                    auto const coords_eval_ND = coords_eval[j];
-                    auto const spline_coef_ND = spline_coef[j];
-                    ddc::device_for_each(
-                            evaluation_domain,
-                            [&](evaluation_domain_type::discrete_element_type const i) {
-                                spline_eval_ND(i) = eval(coords_eval_ND(i), spline_coef_ND);
-                            });
-                });
+    /**
+     * @brief Evaluate ND spline function (described by its spline coefficients) at coordinates computed on the fly.
+     *
+     * Same as the evaluation at coordinates stored in a ChunkSpan, the coordinate of each point being given by a
+     * functor called inside the evaluation kernel, e.g. to compute the feet of the characteristics without storing them.
+     *
+     * @param[out] spline_eval The values of the ND spline function at the desired coordinates. For practical reasons those are
+     * stored in a ChunkSpan defined on a batched_evaluation_domain_type.
+     * @param[in] coords_eval A functor callable on the device, returning the coordinate where the spline is evaluated for
+     * each DiscreteElement of the batched_evaluation_domain_type. Note that only the components along the dimensions of
+     * interest are used.
+     * @param[in] spline_coef A ChunkSpan storing the ND spline coefficients.
+     */
+    template <
+            class Layout1,
+            class Layout2,
+            class BatchedInterpolationDDom,
+            concepts::coordinate_functor<BatchedInterpolationDDom> CoordsFunctor>
+    void operator()(
+            ddc::ChunkSpan<double, BatchedInterpolationDDom, Layout1, memory_space> const
+                    spline_eval,
+            CoordsFunctor const& coords_eval,
+            ddc::ChunkSpan<
+                    double const,
+                    batched_spline_domain_type<BatchedInterpolationDDom>,
+                    Layout2,
+                    memory_space> const spline_coef) const
+    {
+        evaluate_batched(spline_eval, coords_eval, spline_coef);
     }
 
     /**
@@ -579,6 +591,133 @@ public:
                 });
     }
 
+    /**
+     * @brief Evaluate ND spline function (described by its spline coefficients) and its gradient at a given coordinate.
+     *
+     * The B-splines and their first derivatives are evaluated once along each dimension and contracted with the spline
+     * coefficients in a single pass, instead of once per call to operator() and deriv().
+     *
+     * As in deriv(), the coordinate must be inside the domain along the non-periodic dimensions: the extrapolation
+     * rules only define the value of the spline, not its derivatives. It is brought back into the domain along the
+     * periodic dimensions.
+     *
+     * @param coord_eval The coordinate where the spline is evaluated. Note that only the components along the dimensions of interest are used.
+     * @param spline_coef A ChunkSpan storing the ND spline coefficients.
+     *
+     * @return The value of the spline function followed by its derivatives along each dimension of interest.
+     */
+    template <class Layout, class... CoordsDims>
+    KOKKOS_FUNCTION std::array<double, 1 + dimension> eval_with_gradient(
+            ddc::Coordinate<CoordsDims...> const& coord_eval,
+            ddc::ChunkSpan<
+                    double const,
+                    ddc::DiscreteDomain<BSplines...>,
+                    Layout,
+                    memory_space> const spline_coef) const
+    {
+        return eval_derivs<1>(coord_eval, spline_coef);
+    }
+
+    /**
+     * @brief Evaluate ND spline function (described by its spline coefficients), its gradient and its Hessian at a given coordinate.
+     *
+     * Same as eval_with_gradient, the second derivatives being obtained from the same evaluation of the B-splines. They are
+     * zero along a dimension of degree 1.
+     *
+     * @param coord_eval The coordinate where the spline is evaluated. Note that only the components along the dimensions of interest are used.
+     * @param spline_coef A ChunkSpan storing the ND spline coefficients.
+     *
+     * @return The value of the spline function, its derivatives along each dimension of interest, then the upper triangle
+     * of the Hessian stored row by row: (Dim1, Dim1), (Dim1, Dim2), ..., (Dim1, DimN), (Dim2, Dim2), ..., (DimN, DimN).
+     */
+    template <class Layout, class... CoordsDims>
+    KOKKOS_FUNCTION std::array<double, 1 + dimension + dimension * (dimension + 1) / 2>
+    eval_with_hessian(
+            ddc::Coordinate<CoordsDims...> const& coord_eval,
+            ddc::ChunkSpan<
+                    double const,
+                    ddc::DiscreteDomain<BSplines...>,
+                    Layout,
+                    memory_space> const spline_coef) const
+    {
+        return eval_derivs<2>(coord_eval, spline_coef);
+    }
+
+    /**
+     * @brief Evaluate ND spline function (described by its spline coefficients) and its gradient on a mesh.
+     *
+     * This is a batched ND evaluation, computing the values and the derivatives along each dimension of interest of the
+     * spline function in a single kernel. The boundaries are handled as in the single coordinate eval_with_gradient.
+     *
+     * @param[out] spline_eval The values of the ND spline function at the desired coordinates.
+     * @param[out] spline_eval_derivs The derivatives of the ND spline function at the desired coordinates, along each
+     * dimension of interest.
+     * @param[in] coords_eval The coordinates where the spline is evaluated. Those are
+     * stored in a ChunkSpan defined on a batched_evaluation_domain_type.
+     * @param[in] spline_coef A ChunkSpan storing the ND spline coefficients.
+     */
+    template <
+            class Layout1,
+            class Layout2,
+            class Layout3,
+            class Layout4,
+            class BatchedInterpolationDDom,
+            class... CoordsDims>
+    void eval_with_gradient(
+            ddc::ChunkSpan<double, BatchedInterpolationDDom, Layout1, memory_space> const
+                    spline_eval,
+            std::array<
+                    ddc::ChunkSpan<double, BatchedInterpolationDDom, Layout2, memory_space>,
+                    dimension> const& spline_eval_derivs,
+            ddc::ChunkSpan<
+                    ddc::Coordinate<CoordsDims...> const,
+                    BatchedInterpolationDDom,
+                    Layout3,
+                    memory_space> const coords_eval,
+            ddc::ChunkSpan<
+                    double const,
+                    batched_spline_domain_type<BatchedInterpolationDDom>,
+                    Layout4,
+                    memory_space> const spline_coef) const
+    {
+        evaluate_gradient_batched(spline_eval, spline_eval_derivs, coords_eval, spline_coef);
+    }
+
+    /**
+     * @brief Evaluate ND spline function (described by its spline coefficients) and its gradient at coordinates computed on the fly.
+     *
+     * Same as the evaluation at coordinates stored in a ChunkSpan, the coordinate of each point being given by a
+     * functor called inside the evaluation kernel.
+     *
+     * @param[out] spline_eval The values of the ND spline function at the desired coordinates.
+     * @param[out] spline_eval_derivs The derivatives of the ND spline function at the desired coordinates, along each
+     * dimension of interest.
+     * @param[in] coords_eval A functor callable on the device, returning the coordinate where the spline is evaluated for
+     * each DiscreteElement of the batched_evaluation_domain_type.
+     * @param[in] spline_coef A ChunkSpan storing the ND spline coefficients.
+     */
+    template <
+            class Layout1,
+            class Layout2,
+            class Layout3,
+            class BatchedInterpolationDDom,
+            concepts::coordinate_functor<BatchedInterpolationDDom> CoordsFunctor>
+    void eval_with_gradient(
+            ddc::ChunkSpan<double, BatchedInterpolationDDom, Layout1, memory_space> const
+                    spline_eval,
+            std::array<
+                    ddc::ChunkSpan<double, BatchedInterpolationDDom, Layout2, memory_space>,
+                    dimension> const& spline_eval_derivs,
+            CoordsFunctor const& coords_eval,
+            ddc::ChunkSpan<
+                    double const,
+                    batched_spline_domain_type<BatchedInterpolationDDom>,
+                    Layout3,
+                    memory_space> const spline_coef) const
+    {
+        evaluate_gradient_batched(spline_eval, spline_eval_derivs, coords_eval, spline_coef);
+    }
+
     /** @brief Perform batched ND integrations of a spline function (described by its spline coefficients) along the dimensions of interest and store results on a subdomain of batch_domain.
      *
      * The spline coefficients represent a ND spline function defined on a B-splines (basis splines). They can be obtained via various methods, such as using a SplineBuilderND.
@@ -634,6 +773,92 @@ public:
     }
 
 private:
+    /// Evaluates at the coordinates given by a ChunkSpan or by a functor on the batched domain
+    template <class Layout1, class Layout2, class BatchedInterpolationDDom, class CoordsEval>
+    void evaluate_batched(
+            ddc::ChunkSpan<double, BatchedInterpolationDDom, Layout1, memory_space> const
+                    spline_eval,
+            CoordsEval const& coords_eval,
+            ddc::ChunkSpan<
+                    double const,
+                    batched_spline_domain_type<BatchedInterpolationDDom>,
+                    Layout2,
+                    memory_space> const spline_coef) const
+    {
+        using batched_element_type = BatchedInterpolationDDom::discrete_element_type;
+        using evaluation_domain_type = ddc::DiscreteDomain<EvaluationDDim...>;
+        evaluation_domain_type const evaluation_domain(spline_eval.domain());
+
+        batch_domain_type<BatchedInterpolationDDom> const batch_domain(spline_eval.domain());
+
+        ddc::parallel_for_each(
+                "ddc_splines_evaluate_Nd",
+                exec_space(),
+                batch_domain,
+                KOKKOS_CLASS_LAMBDA(
+                        batch_domain_type<BatchedInterpolationDDom>::discrete_element_type const
+                                j) {
+                    auto const spline_eval_ND = spline_eval[j];
+                    auto const spline_coef_ND = spline_coef[j];
+                    ddc::device_for_each(
+                            evaluation_domain,
+                            [&](evaluation_domain_type::discrete_element_type const i) {
+                                spline_eval_ND(i) = eval(
+                                        coords_eval(batched_element_type(i, j)),
+                                        spline_coef_ND);
+                            });
+                });
+    }
+
+    /// Evaluates the values and the gradients at the coordinates given by a ChunkSpan or by a functor on the batched domain
+    template <
+            class Layout1,
+            class Layout2,
+            class Layout3,
+            class BatchedInterpolationDDom,
+            class CoordsEval>
+    void evaluate_gradient_batched(
+            ddc::ChunkSpan<double, BatchedInterpolationDDom, Layout1, memory_space> const
+                    spline_eval,
+            std::array<
+                    ddc::ChunkSpan<double, BatchedInterpolationDDom, Layout2, memory_space>,
+                    dimension> const& spline_eval_derivs,
+            CoordsEval const& coords_eval,
+            ddc::ChunkSpan<
+                    double const,
+                    batched_spline_domain_type<BatchedInterpolationDDom>,
+                    Layout3,
+                    memory_space> const spline_coef) const
+    {
+        using batched_element_type = BatchedInterpolationDDom::discrete_element_type;
+        using evaluation_domain_type = ddc::DiscreteDomain<EvaluationDDim...>;
+        evaluation_domain_type const evaluation_domain(spline_eval.domain());
+
+        batch_domain_type<BatchedInterpolationDDom> const batch_domain(spline_eval.domain());
+
+        ddc::parallel_for_each(
+                "ddc_splines_evaluate_gradient_Nd",
+                exec_space(),
+                batch_domain,
+                KOKKOS_CLASS_LAMBDA(
+                        batch_domain_type<BatchedInterpolationDDom>::discrete_element_type const
+                                j) {
+                    auto const spline_eval_ND = spline_eval[j];
+                    auto const spline_coef_ND = spline_coef[j];
+                    ddc::device_for_each(
+                            evaluation_domain,
+                            [&](evaluation_domain_type::discrete_element_type const i) {
+                                batched_element_type const ij(i, j);
+                                std::array<double, 1 + dimension> const values
+                                        = eval_with_gradient(coords_eval(ij), spline_coef_ND);
+                                spline_eval_ND(i) = values[0];
+                                for (std::size_t d = 0; d < dimension; ++d) {
+                                    spline_eval_derivs[d](ij) = values[d + 1];
+                                }
+                            });
+                });
+    }
+
     template <std::size_t I, class... CoordsDims>
     KOKKOS_INLINE_FUNCTION static void update_coord_eval(ddc::Coordinate<CoordsDims...>& coord_eval)
     {
@@ -769,6 +994,132 @@ private:
         }
     }
 
+    /// The number of values returned by eval_derivs: the value, the gradient and, at order 2, the upper triangle of the Hessian
+    template <std::size_t MaxOrder>
+    static constexpr std::size_t s_nderivs
+            = 1 + dimension + (MaxOrder == 2 ? dimension * (dimension + 1) / 2 : 0);
+
+    /// The highest order of derivation needed along the dimension of BSplinesType, those greater than the degree being zero
+    template <class BSplinesType, std::size_t MaxOrder>
+    static constexpr std::size_t s_deriv_order
+            = MaxOrder < BSplinesType::degree() ? MaxOrder : BSplinesType::degree();
+
+    /// The values of the B-splines of BSplinesType that are non-zero at a point and of their derivatives
+    template <class BSplinesType, std::size_t MaxOrder>
+    using basis_derivs_type = ddc::LocalChunk<
+            double,
+            ddc::StaticDiscreteDomain<
+                    ddc::DiscreteDomain<
+                            BSplinesType,
+                            ddc::Deriv<typename BSplinesType::continuous_dimension_type>>,
+                    BSplinesType::degree() + 1,
+                    s_deriv_order<BSplinesType, MaxOrder> + 1>>;
+
+    /**
+     * @brief Evaluate the function, its gradient and optionally its Hessian at the coordinate given.
+     *
+     * This function brings the coordinate back into the domain along the periodic dimensions and calls
+     * SplineEvaluatorND::eval_derivs_no_bc. As in deriv(), the coordinate must be inside the domain along the
+     * non-periodic dimensions, the extrapolation rules only defining the value of the spline.
+     *
+     * @param[in] coord_eval The coordinate where we want to evaluate.
+     * @param[in] spline_coef The B-splines coefficients of the function we want to evaluate.
+     */
+    template <std::size_t MaxOrder, class Layout, class... CoordsDims>
+    KOKKOS_INLINE_FUNCTION std::array<double, s_nderivs<MaxOrder>> eval_derivs(
+            ddc::Coordinate<CoordsDims...> coord_eval,
+            ddc::ChunkSpan<
+                    double const,
+                    ddc::DiscreteDomain<BSplines...>,
+                    Layout,
+                    memory_space> const spline_coef) const
+    {
+        (update_coord_eval<s_idx<BSplines>>(coord_eval), ...);
+
+        return eval_derivs_no_bc<MaxOrder>(
+                ddc::Coordinate<typename BSplines::continuous_dimension_type...>(
+                        ddc::get<typename BSplines::continuous_dimension_type>(coord_eval)...),
+                spline_coef);
+    }
+
+    template <class BSplinesType, std::size_t MaxOrder>
+    KOKKOS_INLINE_FUNCTION static std::array<double, MaxOrder + 1> get_basis_derivs(
+            basis_derivs_type<BSplinesType, MaxOrder> const& basis_derivs,
+            std::size_t const i)
+    {
+        using deriv_dim = ddc::Deriv<typename BSplinesType::continuous_dimension_type>;
+        std::array<double, MaxOrder + 1> values {};
+        for (std::size_t k = 0; k < s_deriv_order<BSplinesType, MaxOrder> + 1; ++k) {
+            values[k] = basis_derivs(ddc::DiscreteVector<BSplinesType, deriv_dim>(i, k));
+        }
+        return values;
+    }
+
+    /**
+     * @brief Evaluate the function, its gradient and optionally its Hessian at the coordinate given.
+     *
+     * The B-splines and their derivatives are evaluated once along each dimension and contracted with the coefficients in
+     * a single pass.
+     *
+     * @param[in] coord_eval The coordinate where we want to evaluate.
+     * @param[in] spline_coef The B-splines coefficients of the function we want to evaluate.
+     */
+    template <std::size_t MaxOrder, class Layout, class... CoordsDims>
+    KOKKOS_INLINE_FUNCTION std::array<double, s_nderivs<MaxOrder>> eval_derivs_no_bc(
+            ddc::Coordinate<CoordsDims...> const& coord_eval,
+            ddc::ChunkSpan<
+                    double const,
+                    ddc::DiscreteDomain<BSplines...>,
+                    Layout,
+                    memory_space> const spline_coef) const
+    {
+        static_assert(MaxOrder == 1 || MaxOrder == 2);
+
+        auto basis_derivs = cexa::make_tuple(basis_derivs_type<BSplines, MaxOrder>()...);
+
+        auto const jmin = cexa::make_tuple(
+                ddc::discrete_space<BSplines>().eval_basis_and_n_derivs(
+                        cexa::get<s_idx<BSplines>>(basis_derivs).allocation_mdspan(),
+                        ddc::Coordinate<typename BSplines::continuous_dimension_type>(coord_eval),
+                        s_deriv_order<BSplines, MaxOrder>)...);
+
+        std::array<double, s_nderivs<MaxOrder>> derivs {};
+        for_each(
+                std::array<std::size_t, dimension> {(BSplines::degree() + 1)...},
+                [&](std::array<std::size_t, dimension> idx) {
+                    double const coef = spline_coef(
+                            ddc::DiscreteElement<BSplines...>(
+                                    (cexa::get<s_idx<BSplines>>(jmin) + idx[s_idx<BSplines>])...));
+                    // values[d][k] is the k-th derivative of the B-spline idx[d] along d
+                    std::array<std::array<double, MaxOrder + 1>, dimension> const values {
+                            get_basis_derivs<BSplines, MaxOrder>(
+                                    cexa::get<s_idx<BSplines>>(basis_derivs),
+                                    idx[s_idx<BSplines>])...};
+                    // the product of the B-splines derived along d1 and d2, dimension meaning none
+                    auto const product = [&](std::size_t const d1, std::size_t const d2) {
+                        double p = coef;
+                        for (std::size_t d = 0; d < dimension; ++d) {
+                            p *= values[d][(d == d1 ? 1 : 0) + (d == d2 ? 1 : 0)];
+                        }
+                        return p;
+                    };
+                    derivs[0] += product(dimension, dimension);
+                    for (std::size_t d1 = 0; d1 < dimension; ++d1) {
+                        derivs[1 + d1] += product(d1, dimension);
+                    }
+                    if constexpr (MaxOrder == 2) {
+                        std::size_t n = 1 + dimension;
+                        for (std::size_t d1 = 0; d1 < dimension; ++d1) {
+                            for (std::size_t d2 = d1; d2 < dimension; ++d2) {
+                                derivs[n++] += product(d1, d2);
+                            }
+                        }
+                    }
+                });
+
+        return derivs;
+    }
+
     /**
      * @brief Evaluate the function or its derivative at the coordinate given.
      *
@@ -11,6 +11,8 @@
 
 #include <Kokkos_Core.hpp>
 
+#include "memory_accounting.hpp"
+
 namespace ddc {
 
 template <class T, class MemorySpace>
@@ -57,16 +59,21 @@ public:
 
     [[nodiscard]] T* allocate(std::size_t n) const
     {
-        return static_cast<T*>(Kokkos::kokkos_malloc<MemorySpace>(sizeof(T) * n));
+        T* const ptr = static_cast<T*>(Kokkos::kokkos_malloc<MemorySpace>(sizeof(T) * n));
+        detail::record_allocation(ptr, MemorySpace::name(), "", sizeof(T) * n);
+        return ptr;
     }
 
     [[nodiscard]] T* allocate(std::string const& label, std::size_t n) const
     {
-        return static_cast<T*>(Kokkos::kokkos_malloc<MemorySpace>(label, sizeof(T) * n));
+        T* const ptr = static_cast<T*>(Kokkos::kokkos_malloc<MemorySpace>(label, sizeof(T) * n));
+        detail::record_allocation(ptr, MemorySpace::name(), label, sizeof(T) * n);
+        return ptr;
     }
 
     void deallocate(T* p, std::size_t) const
     {
+        detail::record_deallocation(p);
         Kokkos::kokkos_free(p);
     }
 };
@@ -92,4 +99,15 @@ using DeviceAllocator = KokkosAllocator<T, Kokkos::DefaultExecutionSpace::memory
 template <class T>
 using HostAllocator = KokkosAllocator<T, Kokkos::HostSpace>;
 
+/// Page-locked host memory space, faster to transfer from and to the device, that degrades to
+/// `Kokkos::HostSpace` when Kokkos is built without a device backend
+#if defined(KOKKOS_HAS_SHARED_HOST_PINNED_SPACE)
+using PinnedHostSpace = Kokkos::SharedHostPinnedSpace;
+#else
+using PinnedHostSpace = Kokkos::HostSpace;
+#endif
+
+template <class T>
+using PinnedHostAllocator = KokkosAllocator<T, PinnedHostSpace>;
+
 } // namespace ddc
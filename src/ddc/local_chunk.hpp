@@ -0,0 +1,208 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+
+#include <Kokkos_Core.hpp>
+
+#include "detail/kokkos.hpp"
+
+#include "discrete_domain.hpp"
+#include "discrete_element.hpp"
+#include "discrete_vector.hpp"
+#include "static_discrete_domain.hpp"
+
+namespace ddc {
+
+template <class ElementType, class SupportType>
+class LocalChunk;
+
+/** A small chunk with compile-time extents, stored inline
+ *
+ * A LocalChunk owns its values and is meant to be declared on the stack inside a
+ * `KOKKOS_FUNCTION`, e.g. for the `degree + 1` basis values of a spline. Its extents are known at
+ * compile time so that the loops over its domain can be fully unrolled and its values kept in
+ * registers; only the front of its domain is known at runtime.
+ *
+ * @tparam ElementType the type of the values
+ * @tparam SupportType a `StaticDiscreteDomain` all of whose extents are static
+ */
+template <class ElementType, class... DDims, std::size_t... Extents>
+class LocalChunk<ElementType, StaticDiscreteDomain<DiscreteDomain<DDims...>, Extents...>>
+{
+    static_assert(
+            ((Extents != Kokkos::dynamic_extent) && ...),
+            "DDC: LocalChunk expects static extents along all the dimensions");
+
+public:
+    using discrete_domain_type = StaticDiscreteDomain<DiscreteDomain<DDims...>, Extents...>;
+
+    using discrete_element_type = DiscreteElement<DDims...>;
+
+    using discrete_vector_type = DiscreteVector<DDims...>;
+
+    using extents_type = discrete_domain_type::static_extents_type;
+
+    using layout_type = Kokkos::layout_right;
+
+    using allocation_mdspan_type = Kokkos::mdspan<ElementType, extents_type, layout_type>;
+
+    using const_allocation_mdspan_type
+            = Kokkos::mdspan<ElementType const, extents_type, layout_type>;
+
+    using element_type = ElementType;
+
+    using value_type = ElementType;
+
+private:
+    discrete_element_type m_front;
+
+    std::array<ElementType, (std::size_t(1) * ... * Extents)> m_values;
+
+public:
+    static KOKKOS_FUNCTION constexpr std::size_t rank() noexcept
+    {
+        return sizeof...(DDims);
+    }
+
+    static KOKKOS_FUNCTION constexpr std::size_t size() noexcept
+    {
+        return (std::size_t(1) * ... * Extents);
+    }
+
+    static KOKKOS_FUNCTION constexpr discrete_vector_type extents() noexcept
+    {
+        return discrete_vector_type(Extents...);
+    }
+
+    /// LocalChunk whose domain starts at the default DiscreteElement, values are uninitialized
+    KOKKOS_DEFAULTED_FUNCTION LocalChunk() = default;
+
+    /** Construct a LocalChunk with uninitialized values
+     * @param front the first element of the domain of the chunk
+     */
+    KOKKOS_FUNCTION constexpr explicit LocalChunk(discrete_element_type const& front) noexcept
+        : m_front(front)
+    {
+    }
+
+    KOKKOS_DEFAULTED_FUNCTION LocalChunk(LocalChunk const& other) = default;
+
+    KOKKOS_DEFAULTED_FUNCTION LocalChunk(LocalChunk&& other) = default;
+
+    KOKKOS_DEFAULTED_FUNCTION ~LocalChunk() = default;
+
+    KOKKOS_DEFAULTED_FUNCTION LocalChunk& operator=(LocalChunk const& other) = default;
+
+    KOKKOS_DEFAULTED_FUNCTION LocalChunk& operator=(LocalChunk&& other) = default;
+
+    KOKKOS_FUNCTION constexpr discrete_domain_type domain() const noexcept
+    {
+        return discrete_domain_type(m_front);
+    }
+
+    /** Element access using a list of DiscreteElement
+     * @param delems discrete coordinates
+     * @return const-reference to this element
+     */
+    template <concepts::discrete_element... DElems>
+    KOKKOS_FUNCTION constexpr element_type const& operator()(
+            DElems const&... delems) const noexcept
+    {
+        static_assert(
+                sizeof...(DDims) == (0 + ... + DElems::size()),
+                "Invalid number of dimensions");
+        assert(domain().contains(delems...));
+        return DDC_MDSPAN_ACCESS_OP(
+                allocation_mdspan(),
+                detail::array(domain().distance_from_front(delems...)));
+    }
+
+    /** Element access using a list of DiscreteElement
+     * @param delems discrete coordinates
+     * @return reference to this element
+     */
+    template <concepts::discrete_element... DElems>
+    KOKKOS_FUNCTION constexpr element_type& operator()(DElems const&... delems) noexcept
+    {
+        static_assert(
+                sizeof...(DDims) == (0 + ... + DElems::size()),
+                "Invalid number of dimensions");
+        assert(domain().contains(delems...));
+        return DDC_MDSPAN_ACCESS_OP(
+                allocation_mdspan(),
+                detail::array(domain().distance_from_front(delems...)));
+    }
+
+    /** Element access using a list of DiscreteVector
+     * @param dvects discrete vectors from the front of the domain
+     * @return const-reference to this element
+     */
+    template <concepts::discrete_vector... DVects>
+    KOKKOS_FUNCTION constexpr element_type const& operator()(DVects const&... dvects) const noexcept
+        requires(sizeof...(DVects) != 0)
+    {
+        static_assert(
+                sizeof...(DDims) == (0 + ... + DVects::size()),
+                "Invalid number of dimensions");
+        return DDC_MDSPAN_ACCESS_OP(
+                allocation_mdspan(),
+                detail::array(discrete_vector_type(dvects...)));
+    }
+
+    /** Element access using a list of DiscreteVector
+     * @param dvects discrete vectors from the front of the domain
+     * @return reference to this element
+     */
+    template <concepts::discrete_vector... DVects>
+    KOKKOS_FUNCTION constexpr element_type& operator()(DVects const&... dvects) noexcept
+        requires(sizeof...(DVects) != 0)
+    {
+        static_assert(
+                sizeof...(DDims) == (0 + ... + DVects::size()),
+                "Invalid number of dimensions");
+        return DDC_MDSPAN_ACCESS_OP(
+                allocation_mdspan(),
+                detail::array(discrete_vector_type(dvects...)));
+    }
+
+    /** Access to the underlying storage
+     * @return read-only pointer to the values
+     */
+    KOKKOS_FUNCTION constexpr ElementType const* data_handle() const noexcept
+    {
+        return m_values.data();
+    }
+
+    /** Access to the underlying storage
+     * @return pointer to the values
+     */
+    KOKKOS_FUNCTION constexpr ElementType* data_handle() noexcept
+    {
+        return m_values.data();
+    }
+
+    /** Provide a mdspan with static extents on the values
+     * @return read-only mdspan
+     */
+    KOKKOS_FUNCTION constexpr const_allocation_mdspan_type allocation_mdspan() const noexcept
+    {
+        return const_allocation_mdspan_type(m_values.data());
+    }
+
+    /** Provide a mdspan with static extents on the values, it can be given to the functions
+     * filling a `Kokkos::mdspan` such as the evaluation of B-splines
+     * @return mdspan
+     */
+    KOKKOS_FUNCTION constexpr allocation_mdspan_type allocation_mdspan() noexcept
+    {
+        return allocation_mdspan_type(m_values.data());
+    }
+};
+
+} // namespace ddc
@@ -0,0 +1,228 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "memory_accounting.hpp"
+
+namespace {
+
+struct AllocationInfo
+{
+    std::string memory_space;
+
+    std::string label;
+
+    std::size_t nbytes;
+};
+
+void add(ddc::MemoryUsage& usage, std::size_t const nbytes)
+{
+    usage.current_bytes += nbytes;
+    usage.peak_bytes = std::max(usage.peak_bytes, usage.current_bytes);
+    ++usage.nallocations;
+}
+
+void remove(ddc::MemoryUsage& usage, std::size_t const nbytes)
+{
+    usage.current_bytes -= nbytes;
+}
+
+class MemoryRegistry
+{
+    std::mutex m_mutex;
+
+    std::unordered_map<void const*, AllocationInfo> m_allocations;
+
+    std::map<std::string, ddc::MemoryUsage> m_usage_by_space;
+
+    std::map<std::pair<std::string, std::string>, ddc::MemoryUsage> m_usage_by_label;
+
+public:
+    void record_allocation(
+            void const* const ptr,
+            std::string_view const memory_space,
+            std::string_view const label,
+            std::size_t const nbytes)
+    {
+        std::scoped_lock const lock(m_mutex);
+        AllocationInfo info {std::string(memory_space), std::string(label), nbytes};
+        add(m_usage_by_space[info.memory_space], nbytes);
+        add(m_usage_by_label[std::pair(info.memory_space, info.label)], nbytes);
+        m_allocations.insert_or_assign(ptr, std::move(info));
+    }
+
+    // Only looks up the usages, they exist since the allocation was recorded
+    void record_deallocation(void const* const ptr) noexcept
+    {
+        std::scoped_lock const lock(m_mutex);
+        auto const it = m_allocations.find(ptr);
+        if (it == m_allocations.end()) {
+            return;
+        }
+        AllocationInfo const& info = it->second;
+        auto const it_space = m_usage_by_space.find(info.memory_space);
+        if (it_space != m_usage_by_space.end()) {
+            remove(it_space->second, info.nbytes);
+        }
+        auto const it_label = m_usage_by_label.find(std::pair(info.memory_space, info.label));
+        if (it_label != m_usage_by_label.end()) {
+            remove(it_label->second, info.nbytes);
+        }
+        m_allocations.erase(it);
+    }
+
+    ddc::MemoryUsage usage(std::string const& memory_space)
+    {
+        std::scoped_lock const lock(m_mutex);
+        auto const it = m_usage_by_space.find(memory_space);
+        return it == m_usage_by_space.end() ? ddc::MemoryUsage() : it->second;
+    }
+
+    ddc::MemoryUsage usage(std::string const& memory_space, std::string const& label)
+    {
+        std::scoped_lock const lock(m_mutex);
+        auto const it = m_usage_by_label.find(std::pair(memory_space, label));
+        return it == m_usage_by_label.end() ? ddc::MemoryUsage() : it->second;
+    }
+
+    std::map<std::string, ddc::MemoryUsage> usage_by_space()
+    {
+        std::scoped_lock const lock(m_mutex);
+        return m_usage_by_space;
+    }
+
+    std::vector<ddc::LabelledMemoryUsage> usage_by_label()
+    {
+        std::vector<ddc::LabelledMemoryUsage> result;
+        {
+            std::scoped_lock const lock(m_mutex);
+            result.reserve(m_usage_by_label.size());
+            for (auto const& [key, usage] : m_usage_by_label) {
+                result.push_back(ddc::LabelledMemoryUsage {key.first, key.second, usage});
+            }
+        }
+        std::stable_sort(
+                result.begin(),
+                result.end(),
+                [](ddc::LabelledMemoryUsage const& lhs, ddc::LabelledMemoryUsage const& rhs) {
+                    return lhs.usage.peak_bytes > rhs.usage.peak_bytes;
+                });
+        return result;
+    }
+
+    void reset_peaks()
+    {
+        std::scoped_lock const lock(m_mutex);
+        for (auto& [memory_space, usage] : m_usage_by_space) {
+            usage.peak_bytes = usage.current_bytes;
+        }
+        for (auto& [key, usage] : m_usage_by_label) {
+            usage.peak_bytes = usage.current_bytes;
+        }
+    }
+};
+
+// Never destroyed so that the chunks released during the static destruction can be recorded
+MemoryRegistry& registry()
+{
+    static MemoryRegistry* const s_registry = new MemoryRegistry();
+    return *s_registry;
+}
+
+} // namespace
+
+namespace ddc {
+
+namespace detail {
+
+#if DDC_BUILD_MEMORY_ACCOUNTING()
+
+void record_allocation(
+        void const* const ptr,
+        std::string_view const memory_space,
+        std::string_view const label,
+        std::size_t const nbytes)
+{
+    if (ptr != nullptr) {
+        registry().record_allocation(ptr, memory_space, label, nbytes);
+    }
+}
+
+void record_deallocation(void const* const ptr) noexcept
+{
+    if (ptr != nullptr) {
+        registry().record_deallocation(ptr);
+    }
+}
+
+#endif
+
+void print_memory_report_if_requested()
+{
+    char const* const env = std::getenv("DDC_MEMORY_REPORT");
+    if (env != nullptr && std::string_view(env) != "" && std::string_view(env) != "0") {
+        print_memory_report(std::cerr);
+    }
+}
+
+} // namespace detail
+
+MemoryUsage memory_usage(std::string const& memory_space)
+{
+    return registry().usage(memory_space);
+}
+
+MemoryUsage memory_usage(std::string const& memory_space, std::string const& label)
+{
+    return registry().usage(memory_space, label);
+}
+
+std::vector<LabelledMemoryUsage> memory_usage_by_label()
+{
+    return registry().usage_by_label();
+}
+
+void reset_memory_peaks()
+{
+    registry().reset_peaks();
+}
+
+void print_memory_report(std::ostream& os)
+{
+    os << "DDC memory report\n";
+#if !DDC_BUILD_MEMORY_ACCOUNTING()
+    os << "  empty, DDC was built without DDC_BUILD_MEMORY_ACCOUNTING\n";
+#endif
+    for (auto const& [memory_space, usage] : registry().usage_by_space()) {
+        os << "  " << memory_space << ": peak " << usage.peak_bytes << " B, current "
+           << usage.current_bytes << " B, " << usage.nallocations << " allocations\n";
+    }
+    std::vector<LabelledMemoryUsage> const usages = registry().usage_by_label();
+    if (!usages.empty()) {
+        os << "  " << std::left << std::setw(16) << "memory space" << std::setw(40) << "label"
+           << std::right << std::setw(16) << "peak (B)" << std::setw(16) << "current (B)"
+           << std::setw(14) << "allocations" << '\n';
+    }
+    for (LabelledMemoryUsage const& usage : usages) {
+        os << "  " << std::left << std::setw(16) << usage.memory_space << std::setw(40)
+           << usage.label << std::right << std::setw(16) << usage.usage.peak_bytes
+           << std::setw(16) << usage.usage.current_bytes << std::setw(14)
+           << usage.usage.nallocations << '\n';
+    }
+}
+
+} // namespace ddc
@@ -0,0 +1,106 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <ddc/config.hpp>
+
+namespace ddc {
+
+/// The memory usage of a set of allocations
+struct MemoryUsage
+{
+    /// The number of bytes currently allocated
+    std::size_t current_bytes = 0;
+
+    /// The maximum number of bytes allocated at the same time
+    std::size_t peak_bytes = 0;
+
+    /// The number of allocations performed
+    std::size_t nallocations = 0;
+};
+
+/// The memory usage of the allocations sharing a label in a memory space
+struct LabelledMemoryUsage
+{
+    std::string memory_space;
+
+    std::string label;
+
+    MemoryUsage usage;
+};
+
+namespace detail {
+
+#if DDC_BUILD_MEMORY_ACCOUNTING()
+
+/** Records an allocation made by a DDC allocator
+ * @param[in] ptr the allocated pointer, nothing is recorded if it is null
+ * @param[in] memory_space the name of the memory space of the allocation
+ * @param[in] label the label of the allocation
+ * @param[in] nbytes the size of the allocation in bytes
+ */
+void record_allocation(
+        void const* ptr,
+        std::string_view memory_space,
+        std::string_view label,
+        std::size_t nbytes);
+
+/** Records the release of an allocation previously recorded
+ * @param[in] ptr the released pointer, nothing is recorded if it is unknown
+ */
+void record_deallocation(void const* ptr) noexcept;
+
+#else
+
+// Without DDC_BUILD_MEMORY_ACCOUNTING the allocators record nothing and the usages remain empty
+inline void record_allocation(void const*, std::string_view, std::string_view, std::size_t) {}
+
+inline void record_deallocation(void const*) noexcept {}
+
+#endif
+
+/// Prints the memory report if requested by the `DDC_MEMORY_REPORT` environment variable
+void print_memory_report_if_requested();
+
+} // namespace detail
+
+/** Returns the memory usage of the DDC allocators in a memory space
+ * @param[in] memory_space the name of the memory space, as given by `MemorySpace::name()`
+ */
+MemoryUsage memory_usage(std::string const& memory_space);
+
+/** Returns the memory usage of the DDC allocators in a memory space
+ * @tparam MemorySpace a Kokkos memory space
+ */
+template <class MemorySpace>
+MemoryUsage memory_usage()
+{
+    return memory_usage(MemorySpace::name());
+}
+
+/** Returns the memory usage of the allocations with a given label in a memory space
+ * @param[in] memory_space the name of the memory space, as given by `MemorySpace::name()`
+ * @param[in] label the label of the allocations
+ */
+MemoryUsage memory_usage(std::string const& memory_space, std::string const& label);
+
+/// Returns the memory usage of all the labels in all the memory spaces, sorted by decreasing peak
+std::vector<LabelledMemoryUsage> memory_usage_by_label();
+
+/// Sets the peaks to the current usage, for example to measure the peak of a given phase
+void reset_memory_peaks();
+
+/** Prints the memory usage per memory space and per label, sorted by decreasing peak
+ * @param[in] os the output stream
+ */
+void print_memory_report(std::ostream& os);
+
+} // namespace ddc
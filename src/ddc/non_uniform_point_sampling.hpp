@@ -23,6 +23,7 @@
 #include "discrete_element.hpp"
 #include "discrete_space.hpp"
 #include "discrete_vector.hpp"
+#include "real_type.hpp"
 
 namespace ddc {
 
@@ -34,8 +35,149 @@ struct NonUniformPointSamplingBase
 
 void print_non_uniform_point_samplig(std::ostream& os, std::size_t size);
 
+/// The columns of the metrics array of a `NonUniformPointSampling`
+enum NonUniformMetric : std::size_t {
+    distance_at_left_metric,
+    distance_at_right_metric,
+    cell_width_metric,
+    inv_distance_at_left_metric,
+    inv_distance_at_right_metric,
+    inv_cell_width_metric,
+    nb_metrics
+};
+
+/** Computes the metrics of a sorted list of points, stored column by column
+ *
+ * At the ends the missing distance is replaced by the distance on the other side. With less than
+ * two points there is no distance to measure and all the metrics are 0.
+ */
+template <class CDim>
+std::vector<Real> compute_non_uniform_metrics(std::vector<Coordinate<CDim>> const& points)
+{
+    std::size_t const n = points.size();
+    std::vector<Real> metrics(n * nb_metrics);
+    if (n < 2) {
+        return metrics;
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        Real const dx_left = i > 0 ? Real(points[i] - points[i - 1]) : Real(0);
+        Real const dx_right = i + 1 < n ? Real(points[i + 1] - points[i]) : Real(0);
+        metrics[distance_at_left_metric * n + i] = i > 0 ? dx_left : dx_right;
+        metrics[distance_at_right_metric * n + i] = i + 1 < n ? dx_right : dx_left;
+        metrics[cell_width_metric * n + i] = (metrics[distance_at_left_metric * n + i]
+                                              + metrics[distance_at_right_metric * n + i])
+                                             / 2;
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        metrics[inv_distance_at_left_metric * n + i] = 1 / metrics[distance_at_left_metric * n + i];
+        metrics[inv_distance_at_right_metric * n + i]
+                = 1 / metrics[distance_at_right_metric * n + i];
+        metrics[inv_cell_width_metric * n + i] = 1 / metrics[cell_width_metric * n + i];
+    }
+    return metrics;
+}
+
+/** Computes the uniform bucket grid accelerating the location of a coordinate
+ *
+ * The segment spanned by the points is split into as many buckets of equal width as there are
+ * cells, each bucket storing the first cell it intersects, i.e. the index of the last point at
+ * or before its left edge. A coordinate is then located by one multiply, giving the range of
+ * cells intersecting its bucket, and a binary search in this range. On a strongly graded mesh a
+ * bucket may hold many cells, the binary search keeps the lookup logarithmic in this case.
+ * @return the first cell of each bucket and the inverse of the width of the buckets
+ */
+template <class CDim>
+std::pair<std::vector<std::size_t>, Real> compute_cell_buckets(
+        std::vector<Coordinate<CDim>> const& points)
+{
+    std::size_t const ncells = points.size() < 2 ? 0 : points.size() - 1;
+    std::vector<std::size_t> buckets(std::max(ncells, std::size_t(1)), 0);
+    Real const length = ncells == 0 ? Real(0) : Real(points.back() - points.front());
+    if (length <= 0) {
+        return std::pair(std::move(buckets), Real(0));
+    }
+    Real const width = length / buckets.size();
+    std::size_t icell = 0;
+    for (std::size_t ib = 0; ib < buckets.size(); ++ib) {
+        Coordinate<CDim> const left_edge(Real(points.front()) + ib * width);
+        while (icell + 1 < ncells && points[icell + 1] <= left_edge) {
+            ++icell;
+        }
+        buckets[ib] = icell;
+    }
+    return std::pair(std::move(buckets), 1 / width);
+}
+
 } // namespace detail
 
+/** The spacings around the points of a `NonUniformPointSampling` and their inverses, computed
+ * once by `init_discrete_space`
+ *
+ * A `MeshMetrics` is a lightweight handle meant to be captured by value in a kernel: each
+ * accessor is a single load from a contiguous array, without going through `discrete_space`.
+ * At the ends of the sampling the missing distance is replaced by the distance on the other
+ * side. The handle must not outlive the discrete space.
+ */
+template <class DDim>
+class MeshMetrics
+{
+    using coordinate_type = Coordinate<typename DDim::continuous_dimension_type>;
+
+    DiscreteElement<DDim> m_front;
+
+    Real const* m_metrics;
+
+    std::size_t m_size;
+
+    KOKKOS_FUNCTION Real get(detail::NonUniformMetric const metric, DiscreteElement<DDim> const i)
+            const noexcept
+    {
+        assert(i >= m_front && static_cast<std::size_t>((i - m_front).value()) < m_size);
+        return m_metrics[metric * m_size + (i - m_front).value()];
+    }
+
+public:
+    MeshMetrics(DiscreteElement<DDim> const front, Real const* metrics, std::size_t const size)
+        : m_front(front)
+        , m_metrics(metrics)
+        , m_size(size)
+    {
+    }
+
+    /// @return the distance between the point `i` and the point before, or after at the first point
+    KOKKOS_FUNCTION coordinate_type distance_at_left(DiscreteElement<DDim> const i) const noexcept
+    {
+        return coordinate_type(get(detail::distance_at_left_metric, i));
+    }
+
+    /// @return the distance between the point `i` and the point after, or before at the last point
+    KOKKOS_FUNCTION coordinate_type distance_at_right(DiscreteElement<DDim> const i) const noexcept
+    {
+        return coordinate_type(get(detail::distance_at_right_metric, i));
+    }
+
+    /// @return the width of the cell centred on the point `i`, the mean of the distances
+    KOKKOS_FUNCTION coordinate_type cell_width(DiscreteElement<DDim> const i) const noexcept
+    {
+        return coordinate_type(get(detail::cell_width_metric, i));
+    }
+
+    KOKKOS_FUNCTION Real inv_distance_at_left(DiscreteElement<DDim> const i) const noexcept
+    {
+        return get(detail::inv_distance_at_left_metric, i);
+    }
+
+    KOKKOS_FUNCTION Real inv_distance_at_right(DiscreteElement<DDim> const i) const noexcept
+    {
+        return get(detail::inv_distance_at_right_metric, i);
+    }
+
+    KOKKOS_FUNCTION Real inv_cell_width(DiscreteElement<DDim> const i) const noexcept
+    {
+        return get(detail::inv_cell_width_metric, i);
+    }
+};
+
 /// `NonUniformPointSampling` models a non-uniform discretization of the `CDim` segment \f$[a, b]\f$.
 template <class CDim>
 class NonUniformPointSampling : detail::NonUniformPointSamplingBase
@@ -54,6 +196,14 @@ public:
 
         Kokkos::View<Coordinate<CDim>*, MemorySpace> m_points;
 
+        // the metrics of the points, one column per `detail::NonUniformMetric`
+        Kokkos::View<Real**, Kokkos::LayoutLeft, MemorySpace> m_metrics;
+
+        // the first cell of each bucket, see `detail::compute_cell_buckets`
+        Kokkos::View<std::size_t*, MemorySpace> m_cell_buckets;
+
+        Real m_inv_bucket_width = 0;
+
         DiscreteElement<DDim> m_reference;
 
     public:
@@ -92,11 +242,37 @@ public:
             std::vector<Coordinate<CDim>> host_points(points_begin, points_end);
             m_points = view_type("NonUniformPointSampling::points", host_points.size());
             Kokkos::deep_copy(m_points, view_type(host_points.data(), host_points.size()));
+            std::vector<Real> const host_metrics
+                    = detail::compute_non_uniform_metrics(host_points);
+            m_metrics = Kokkos::View<Real**, Kokkos::LayoutLeft, MemorySpace>(
+                    "NonUniformPointSampling::metrics",
+                    host_points.size(),
+                    detail::nb_metrics);
+            Kokkos::deep_copy(
+                    m_metrics,
+                    Kokkos::View<Real**, Kokkos::LayoutLeft, Kokkos::HostSpace>(
+                            host_metrics.data(),
+                            host_points.size(),
+                            detail::nb_metrics));
+            auto [host_buckets, inv_bucket_width] = detail::compute_cell_buckets(host_points);
+            m_cell_buckets = Kokkos::View<std::size_t*, MemorySpace>(
+                    "NonUniformPointSampling::cell_buckets",
+                    host_buckets.size());
+            Kokkos::deep_copy(
+                    m_cell_buckets,
+                    Kokkos::View<std::size_t*, Kokkos::HostSpace>(
+                            host_buckets.data(),
+                            host_buckets.size()));
+            m_inv_bucket_width = inv_bucket_width;
         }
 
         template <class OriginMemorySpace>
         explicit Impl(Impl<DDim, OriginMemorySpace> const& impl)
             : m_points(Kokkos::create_mirror_view_and_copy(MemorySpace(), impl.m_points))
+            , m_metrics(Kokkos::create_mirror_view_and_copy(MemorySpace(), impl.m_metrics))
+            , m_cell_buckets(
+                      Kokkos::create_mirror_view_and_copy(MemorySpace(), impl.m_cell_buckets))
+            , m_inv_bucket_width(impl.m_inv_bucket_width)
             , m_reference(impl.m_reference)
         {
         }
@@ -128,6 +304,77 @@ public:
         {
             return m_points((icoord - front()).value());
         }
+
+        /** @brief Distance between the point `icoord` and the point before
+         *
+         * At the first point, the distance to the point after. The sampling must have at least
+         * two points.
+         */
+        KOKKOS_FUNCTION Coordinate<CDim> distance_at_left(
+                discrete_element_type const& icoord) const noexcept
+        {
+            KOKKOS_ASSERT(size() >= 2)
+            return Coordinate<CDim>(
+                    m_metrics((icoord - front()).value(), detail::distance_at_left_metric));
+        }
+
+        /** @brief Distance between the point `icoord` and the point after
+         *
+         * At the last point, the distance to the point before. The sampling must have at least
+         * two points.
+         */
+        KOKKOS_FUNCTION Coordinate<CDim> distance_at_right(
+                discrete_element_type const& icoord) const noexcept
+        {
+            KOKKOS_ASSERT(size() >= 2)
+            return Coordinate<CDim>(
+                    m_metrics((icoord - front()).value(), detail::distance_at_right_metric));
+        }
+
+        /** @brief Locate the cell containing a position in `CDim`
+         *
+         * The bucket grid built at construction brackets the cell, which is then found by a binary
+         * search within the cells of the bucket.
+         * @return the last point at or before `x`, clamped so that a cell starts at it
+         */
+        KOKKOS_FUNCTION discrete_element_type locate(Coordinate<CDim> const& x) const noexcept
+        {
+            std::size_t const n = m_points.size();
+            if (n < 2 || x <= m_points(0)) {
+                return front();
+            }
+            if (x >= m_points(n - 1)) {
+                return front() + discrete_vector_type(n - 2);
+            }
+            std::size_t const nbuckets = m_cell_buckets.size();
+            auto const ib = static_cast<std::size_t>(Real(x - m_points(0)) * m_inv_bucket_width);
+            std::size_t const jb = ib < nbuckets ? ib : nbuckets - 1;
+            std::size_t low = m_cell_buckets(jb);
+            std::size_t high = jb + 1 < nbuckets ? m_cell_buckets(jb + 1) : n - 2;
+            // guard against the rounding of the bucket index
+            if (m_points(low) > x) {
+                low = 0;
+            }
+            if (m_points(high + 1) <= x) {
+                high = n - 2;
+            }
+            // the last point at or before x among the cells of the bucket
+            while (low < high) {
+                std::size_t const mid = low + (high - low + 1) / 2;
+                if (m_points(mid) <= x) {
+                    low = mid;
+                } else {
+                    high = mid - 1;
+                }
+            }
+            return front() + discrete_vector_type(low);
+        }
+
+        /// @brief Handle on the precomputed metrics, to be captured by value in a kernel
+        MeshMetrics<DDim> metrics() const noexcept
+        {
+            return MeshMetrics<DDim>(front(), m_metrics.data(), m_metrics.extent(0));
+        }
     };
 
     /** Construct an Impl<Kokkos::HostSpace> and associated discrete_domain_type from a range
@@ -226,14 +473,45 @@ template <concepts::non_uniform_point_sampling DDim>
 KOKKOS_FUNCTION Coordinate<typename DDim::continuous_dimension_type> distance_at_left(
         DiscreteElement<DDim> i)
 {
-    return coordinate(i) - coordinate(i - 1);
+    return discrete_space<DDim>().distance_at_left(i);
 }
 
 template <concepts::non_uniform_point_sampling DDim>
 KOKKOS_FUNCTION Coordinate<typename DDim::continuous_dimension_type> distance_at_right(
         DiscreteElement<DDim> i)
 {
-    return coordinate(i + 1) - coordinate(i);
+    return discrete_space<DDim>().distance_at_right(i);
+}
+
+/** Locate the cell of a non-uniform sampling containing a position
+ * @tparam DDim a discrete dimension modelled by a `NonUniformPointSampling`
+ * @param[in] x the position
+ * @return the last point at or before `x`, clamped so that a cell starts at it
+ */
+template <concepts::non_uniform_point_sampling DDim>
+KOKKOS_FUNCTION DiscreteElement<DDim> locate(
+        Coordinate<typename DDim::continuous_dimension_type> const& x)
+{
+    return discrete_space<DDim>().locate(x);
+}
+
+/** The precomputed metrics of a non-uniform sampling, accessible from the default execution space
+ * @tparam DDim a discrete dimension modelled by a `NonUniformPointSampling`
+ */
+template <concepts::non_uniform_point_sampling DDim>
+MeshMetrics<DDim> mesh_metrics()
+{
+    assert(is_discrete_space_initialized<DDim>());
+    return detail::g_discrete_space_dual<DDim>->get_device().metrics();
+}
+
+/** The precomputed metrics of a non-uniform sampling, accessible from the host
+ * @tparam DDim a discrete dimension modelled by a `NonUniformPointSampling`
+ */
+template <concepts::non_uniform_point_sampling DDim>
+MeshMetrics<DDim> host_mesh_metrics()
+{
+    return host_discrete_space<DDim>().metrics();
 }
 
 template <concepts::non_uniform_point_sampling DDim>
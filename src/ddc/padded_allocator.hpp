@@ -0,0 +1,160 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include "kokkos_allocator.hpp"
+
+namespace ddc {
+
+/** An allocator adaptor making the rows of the chunks start on aligned addresses.
+ *
+ * A `Chunk` built with this allocator has a `layout_stride` layout: the innermost dimension is
+ * contiguous and the pitch between two rows is padded to an odd number of blocks of `N` bytes.
+ * The rows are thus aligned for SIMD loads and, even when the extents are powers of two,
+ * successive rows do not map to the same cache sets. The spans of such a chunk are strided
+ * `ChunkSpan`s that can be sliced and given to the parallel algorithms as any other.
+ * @tparam Allocator the allocator of the underlying storage, it must align its allocations on at
+ *         least `N` bytes for the rows to be aligned
+ * @tparam N the alignment of the rows in bytes, a power of two
+ */
+template <class Allocator, std::size_t N = 64>
+class PaddedAllocator
+{
+    static_assert((N & (N - 1)) == 0, "The alignment must be a power of two");
+
+    Allocator m_allocator;
+
+public:
+    using value_type = Allocator::value_type;
+
+    using memory_space = Allocator::memory_space;
+
+    using layout_type = Kokkos::layout_stride;
+
+    template <class U>
+    struct rebind
+    {
+        using other = PaddedAllocator<
+                typename std::allocator_traits<Allocator>::template rebind_alloc<U>,
+                N>;
+    };
+
+    constexpr PaddedAllocator() = default;
+
+    constexpr explicit PaddedAllocator(Allocator allocator) : m_allocator(std::move(allocator)) {}
+
+    constexpr PaddedAllocator(PaddedAllocator const& x) = default;
+
+    constexpr PaddedAllocator(PaddedAllocator&& x) noexcept = default;
+
+    template <class OAllocator>
+    constexpr explicit PaddedAllocator(PaddedAllocator<OAllocator, N> const& x)
+        : m_allocator(x.allocator())
+    {
+    }
+
+    ~PaddedAllocator() = default;
+
+    constexpr PaddedAllocator& operator=(PaddedAllocator const& x) = default;
+
+    constexpr PaddedAllocator& operator=(PaddedAllocator&& x) noexcept = default;
+
+    /// Returns the underlying allocator
+    constexpr Allocator const& allocator() const noexcept
+    {
+        return m_allocator;
+    }
+
+    /** Returns the padded pitch of the rows
+     * @param n the number of elements of a row
+     * @return the distance in elements between the beginnings of two successive rows
+     */
+    static constexpr std::size_t pitch(std::size_t const n) noexcept
+    {
+        if constexpr (N % sizeof(value_type) != 0) {
+            // The rows of such a type cannot all be aligned
+            return n;
+        } else {
+            std::size_t const nelems_per_block = N / sizeof(value_type);
+            std::size_t nblocks = (n + nelems_per_block - 1) / nelems_per_block;
+            if (nblocks % 2 == 0) {
+                ++nblocks;
+            }
+            return nblocks * nelems_per_block;
+        }
+    }
+
+    /** Builds the padded mapping of a chunk
+     * @param extents the extents of the chunk
+     * @return a mapping where the innermost dimension is contiguous and the rows are padded
+     */
+    template <class Extents>
+    static constexpr layout_type::mapping<Extents> mapping(Extents const& extents) noexcept
+    {
+        static constexpr std::size_t rank = Extents::rank();
+        std::array<std::size_t, rank> strides {};
+        if constexpr (rank > 0) {
+            strides[rank - 1] = 1;
+            if constexpr (rank > 1) {
+                strides[rank - 2] = pitch(extents.extent(rank - 1));
+                for (std::size_t i = rank - 2; i-- > 0;) {
+                    strides[i] = strides[i + 1] * extents.extent(i + 1);
+                }
+            }
+        }
+        return layout_type::mapping<Extents>(extents, strides);
+    }
+
+    [[nodiscard]] value_type* allocate(std::size_t n) const
+    {
+        return m_allocator.allocate(n);
+    }
+
+    [[nodiscard]] value_type* allocate(std::string const& label, std::size_t n) const
+    {
+        return m_allocator.allocate(label, n);
+    }
+
+    void deallocate(value_type* p, std::size_t n) const
+    {
+        m_allocator.deallocate(p, n);
+    }
+
+    void deallocate(std::string const& label, value_type* p, std::size_t n) const
+        requires requires { std::declval<Allocator const&>().deallocate(label, p, n); }
+    {
+        m_allocator.deallocate(label, p, n);
+    }
+};
+
+template <class AT, std::size_t NT, class AU, std::size_t NU>
+constexpr bool operator==(
+        PaddedAllocator<AT, NT> const& lhs,
+        PaddedAllocator<AU, NU> const& rhs) noexcept
+{
+    return NT == NU && lhs.allocator() == rhs.allocator();
+}
+
+#if !defined(__cpp_impl_three_way_comparison) || __cpp_impl_three_way_comparison < 201902L
+// In C++20, `a!=b` shall be automatically translated by the compiler to `!(a==b)`
+template <class AT, std::size_t NT, class AU, std::size_t NU>
+constexpr bool operator!=(
+        PaddedAllocator<AT, NT> const& lhs,
+        PaddedAllocator<AU, NU> const& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+#endif
+
+} // namespace ddc
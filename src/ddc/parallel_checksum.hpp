@@ -0,0 +1,145 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include "chunk_traits.hpp"
+#include "discrete_vector.hpp"
+#include "parallel_transform_reduce.hpp"
+#include "reducer.hpp"
+
+namespace ddc {
+
+namespace detail {
+
+/// Finalizer of the SplitMix64 generator, a bijection of the 64-bit integers in which every input
+/// bit affects every output bit
+KOKKOS_FUNCTION constexpr std::uint64_t checksum_mix(std::uint64_t x) noexcept
+{
+    x ^= x >> 30;
+    x *= 0xbf58'476d'1ce4'e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d0'49bb'1331'11ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+/** Hashes the object representation of a value together with its position
+ * @param[in] value the value to hash
+ * @param[in] position the row-major linear index of the value in its domain
+ */
+template <class ElementType>
+KOKKOS_FUNCTION std::uint64_t checksum_element(
+        ElementType const& value,
+        std::uint64_t const position) noexcept
+{
+    static constexpr std::size_t word_size = sizeof(std::uint64_t);
+    unsigned char const* const bytes = reinterpret_cast<unsigned char const*>(&value);
+    std::uint64_t hash = checksum_mix(position + 0x9e37'79b9'7f4a'7c15ULL);
+    for (std::size_t i = 0; i < sizeof(ElementType); i += word_size) {
+        std::uint64_t word = 0;
+        for (std::size_t j = i; j < i + word_size && j < sizeof(ElementType); ++j) {
+            word |= static_cast<std::uint64_t>(bytes[j]) << (8 * (j - i));
+        }
+        hash = checksum_mix(hash ^ word);
+    }
+    return hash;
+}
+
+template <class ChunkSpan>
+class ChecksumTransform
+{
+    ChunkSpan m_chunk_span;
+
+public:
+    explicit ChecksumTransform(ChunkSpan const& chunk_span) : m_chunk_span(chunk_span) {}
+
+    KOKKOS_FUNCTION std::uint64_t operator()(
+            typename ChunkSpan::discrete_element_type const& delem) const noexcept
+    {
+        typename ChunkSpan::discrete_domain_type const domain = m_chunk_span.domain();
+        std::array const ids = detail::array(domain.distance_from_front(delem));
+        std::array const size = detail::array(domain.extents());
+        std::uint64_t position = 0;
+        for (std::size_t i = 0; i < ids.size(); ++i) {
+            position = position * static_cast<std::uint64_t>(size[i])
+                       + static_cast<std::uint64_t>(ids[i]);
+        }
+        return checksum_element(m_chunk_span(delem), position);
+    }
+};
+
+} // namespace detail
+
+/** Computes in parallel a 64-bit checksum of the values of a borrowed chunk, for example to check
+ * the integrity of a buffer after a copy or a checkpoint.
+ *
+ * The object representation of each value is hashed together with its position in the domain and
+ * the hashes are combined with a bitwise exclusive or, so that the result does not depend on the
+ * execution space nor on the layout. Values whose type has padding bytes may give different
+ * checksums even if they compare equal.
+ * @param[in] label name for easy identification of the parallel_checksum algorithm
+ * @param[in] execution_space a Kokkos execution space where the loop will be executed on
+ * @param[in] src the borrowed chunk to hash
+ * @return the checksum of `src`
+ */
+template <class ExecSpace, concepts::borrowed_chunk ChunkSrc>
+std::uint64_t parallel_checksum(
+        std::string const& label,
+        ExecSpace const& execution_space,
+        ChunkSrc&& src)
+{
+    using chunk_span_type = decltype(src.span_cview());
+    static_assert(
+            std::is_trivially_copyable_v<chunk_value_t<ChunkSrc>>,
+            "The checksum requires trivially copyable values");
+    static_assert(
+            Kokkos::SpaceAccessibility<ExecSpace, typename chunk_span_type::memory_space>::
+                    accessible,
+            "The execution space must be able to access the memory space of the chunk");
+    return parallel_transform_reduce(
+            label,
+            execution_space,
+            src.domain(),
+            std::uint64_t(0),
+            reducer::bxor<std::uint64_t>(),
+            detail::ChecksumTransform(src.span_cview()));
+}
+
+/** Computes in parallel a 64-bit checksum of the values of a borrowed chunk
+ * @param[in] execution_space a Kokkos execution space where the loop will be executed on
+ * @param[in] src the borrowed chunk to hash
+ * @return the checksum of `src`
+ */
+template <class ExecSpace, concepts::borrowed_chunk ChunkSrc>
+std::uint64_t parallel_checksum(ExecSpace const& execution_space, ChunkSrc&& src)
+    requires(Kokkos::is_execution_space_v<ExecSpace>)
+{
+    return parallel_checksum(
+            "ddc_parallel_checksum_default",
+            execution_space,
+            std::forward<ChunkSrc>(src));
+}
+
+/** Computes in parallel a 64-bit checksum of the values of a borrowed chunk using the default
+ * execution space
+ * @param[in] src the borrowed chunk to hash
+ * @return the checksum of `src`
+ */
+template <concepts::borrowed_chunk ChunkSrc>
+std::uint64_t parallel_checksum(ChunkSrc&& src)
+{
+    return parallel_checksum(Kokkos::DefaultExecutionSpace(), std::forward<ChunkSrc>(src));
+}
+
+} // namespace ddc
@@ -0,0 +1,376 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include "chunk_span.hpp"
+#include "chunk_traits.hpp"
+#include "discrete_domain.hpp"
+#include "discrete_element.hpp"
+#include "discrete_vector.hpp"
+#include "team_for_each.hpp"
+
+namespace ddc {
+
+/** The values of a chunk around a point, as seen by the functor of `parallel_stencil`
+ *
+ * The values are read from a tile copied into the scratch memory of the team, only the offsets
+ * within the radius of the stencil can be accessed.
+ */
+template <class ScratchSpan>
+class StencilNeighbourhood
+{
+public:
+    using discrete_element_type = ScratchSpan::discrete_element_type;
+
+    using element_type = ScratchSpan::value_type;
+
+private:
+    ScratchSpan m_values;
+
+    discrete_element_type m_center;
+
+public:
+    KOKKOS_FUNCTION StencilNeighbourhood(
+            ScratchSpan const& values,
+            discrete_element_type const& center) noexcept
+        : m_values(values)
+        , m_center(center)
+    {
+    }
+
+    /// @return the point at the center of the neighbourhood
+    KOKKOS_FUNCTION discrete_element_type element() const noexcept
+    {
+        return m_center;
+    }
+
+    /** Access to a neighbour
+     * @param offsets the offsets from the center, the missing dimensions are not shifted
+     * @return const-reference to the value of the neighbour
+     */
+    template <concepts::discrete_vector... DVects>
+    KOKKOS_FUNCTION element_type const& operator()(DVects const&... offsets) const noexcept
+    {
+        discrete_element_type element = m_center;
+        ((element += offsets), ...);
+        assert(m_values.domain().contains(element));
+        return m_values(element);
+    }
+};
+
+/// The tuning parameters of `parallel_stencil`
+template <class... DDims>
+struct StencilOptions
+{
+    /// the extents of the block of output points computed by a team
+    DiscreteVector<DDims...> tile;
+
+    /** the number of successive applications of the stencil on a tile (temporal blocking)
+     *
+     * The intermediate steps are also computed on the halo, from the values of the input around
+     * it: the ghosts are advanced by the stencil instead of being filled again between two steps.
+     * The result matches `nsteps` separate applications only if the ghosts would be updated like
+     * the inner points, typically periodic ghosts, not for fixed boundary values.
+     */
+    int nsteps = 1;
+};
+
+/** The default extents of the tiles of `parallel_stencil`
+ *
+ * The tiles are elongated along the last dimension, contiguous in memory: 32 points on a device
+ * to match the size of a warp and 128 on the host, 8 points along the other dimensions in 2D and
+ * 4 in higher dimensions.
+ */
+template <class ExecSpace, class... DDims>
+DiscreteVector<DDims...> default_stencil_tile(DiscreteVector<DDims...> const& /*radius*/)
+{
+    constexpr std::size_t rank = sizeof...(DDims);
+    constexpr DiscreteVectorElement last_extent
+            = Kokkos::SpaceAccessibility<ExecSpace, Kokkos::HostSpace>::accessible ? 128 : 32;
+    constexpr DiscreteVectorElement other_extent = rank == 2 ? 8 : 4;
+    return DiscreteVector<DDims...>(
+            (type_seq_rank_v<DDims, detail::TypeSeq<DDims...>> + 1 == rank ? last_extent
+                                                                            : other_extent)...);
+}
+
+namespace detail {
+
+/// Computes a tile of the output per team, from a copy of its halo in the team scratch memory
+template <class ExecSpace, class OutSpan, class InSpan, class Functor, class... DDims>
+class StencilKernel
+{
+    using member_type = Kokkos::TeamPolicy<ExecSpace>::member_type;
+
+    using domain_type = DiscreteDomain<DDims...>;
+
+    using vector_type = DiscreteVector<DDims...>;
+
+    using value_type = std::remove_const_t<typename InSpan::element_type>;
+
+    using scratch_span = ChunkSpan<
+            value_type,
+            domain_type,
+            Kokkos::layout_right,
+            typename ExecSpace::scratch_memory_space>;
+
+    OutSpan m_out;
+
+    InSpan m_in;
+
+    Functor m_f;
+
+    domain_type m_domain;
+
+    vector_type m_radius;
+
+    vector_type m_tile;
+
+    vector_type m_ntiles;
+
+    int m_nsteps;
+
+public:
+    StencilKernel(
+            OutSpan const& out,
+            InSpan const& in,
+            vector_type const& radius,
+            Functor const& f,
+            StencilOptions<DDims...> const& options)
+        : m_out(out)
+        , m_in(in)
+        , m_f(f)
+        , m_domain(out.domain())
+        , m_radius(radius)
+        , m_tile(options.tile)
+        , m_ntiles(
+                  ((get<DDims>(m_domain.extents()) + get<DDims>(options.tile) - 1)
+                   / get<DDims>(options.tile))...)
+        , m_nsteps(options.nsteps)
+    {
+    }
+
+    /// @return the number of tiles, i.e. of teams
+    std::size_t league_size() const noexcept
+    {
+        return (std::size_t(1) * ... * static_cast<std::size_t>(get<DDims>(m_ntiles)));
+    }
+
+    /// @return the size in bytes of the scratch memory of a team
+    std::size_t scratch_size() const noexcept
+    {
+        std::size_t const halo_size
+                = (std::size_t(1) * ...
+                   * static_cast<std::size_t>(
+                           get<DDims>(m_tile) + 2 * m_nsteps * get<DDims>(m_radius)));
+        using scratch_view = Kokkos::View<
+                value_type*,
+                typename ExecSpace::scratch_memory_space,
+                Kokkos::MemoryUnmanaged>;
+        return (m_nsteps > 1 ? 2 : 1) * scratch_view::shmem_size(halo_size);
+    }
+
+    KOKKOS_FUNCTION void operator()(member_type const& team) const
+    {
+        std::array<DiscreteVectorElement, sizeof...(DDims)> tile_index {};
+        std::array const ntiles = detail::array(m_ntiles);
+        DiscreteVectorElement league_rank = team.league_rank();
+        for (std::size_t i = ntiles.size(); i-- > 0;) {
+            tile_index[i] = league_rank % ntiles[i];
+            league_rank /= ntiles[i];
+        }
+        vector_type const offset(
+                (tile_index[type_seq_rank_v<DDims, TypeSeq<DDims...>>] * get<DDims>(m_tile))...);
+        domain_type const tile_domain(
+                m_domain.front() + offset,
+                vector_type(
+                        (Kokkos::min(
+                                get<DDims>(m_tile),
+                                get<DDims>(m_domain.extents()) - get<DDims>(offset)))...));
+        domain_type const halo_domain = extended(tile_domain, m_nsteps);
+
+        scratch_span values(
+                static_cast<value_type*>(team.team_scratch(0).get_shmem(
+                        halo_domain.size() * sizeof(value_type))),
+                halo_domain);
+        team_for_each(team, halo_domain, [&](typename domain_type::discrete_element_type e) {
+            values(e) = m_in(e);
+        });
+        team.team_barrier();
+
+        if (m_nsteps > 1) {
+            scratch_span next_values(
+                    static_cast<value_type*>(team.team_scratch(0).get_shmem(
+                            halo_domain.size() * sizeof(value_type))),
+                    halo_domain);
+            for (int step = 1; step < m_nsteps; ++step) {
+                // the region where the values are valid shrinks by a radius at each step
+                team_for_each(
+                        team,
+                        extended(tile_domain, m_nsteps - step),
+                        [&](typename domain_type::discrete_element_type e) {
+                            next_values(e)
+                                    = m_f(StencilNeighbourhood<scratch_span>(values, e));
+                        });
+                team.team_barrier();
+                scratch_span const previous_values = values;
+                values = next_values;
+                next_values = previous_values;
+            }
+        }
+
+        team_for_each(team, tile_domain, [&](typename domain_type::discrete_element_type e) {
+            m_out(e) = m_f(StencilNeighbourhood<scratch_span>(values, e));
+        });
+    }
+
+private:
+    KOKKOS_FUNCTION domain_type extended(domain_type const& domain, int const nsteps) const
+    {
+        return domain_type(
+                domain.front() - nsteps * m_radius,
+                domain.extents() + 2 * nsteps * m_radius);
+    }
+};
+
+} // namespace detail
+
+/** Applies a stencil on each point of a domain, the input being tiled in the scratch memory
+ *
+ * Each team of the `Kokkos` execution space computes a tile of `out`, after copying the tile
+ * and its halo from `in` to its scratch memory, so that the neighbours shared by the points of
+ * the tile are read once from the global memory. With `options.nsteps > 1` the stencil is
+ * applied `nsteps` times in a row on the tile before writing the result (temporal blocking), the
+ * halo being enlarged accordingly: `in` must then hold valid values up to `nsteps * radius`
+ * around `out`, for instance ghosts filled by `fill_ghosts`. The ghosts are not filled again
+ * between the steps, see `StencilOptions::nsteps` for the boundary conditions this supports.
+ * @param[in] execution_space a Kokkos execution space where the loop will be executed on
+ * @param[out] out the borrowed chunk receiving the results, the stencil is applied on its domain
+ * @param[in] in the borrowed chunk the stencil reads, defined at least on the domain of `out`
+ *            extended by `options.nsteps * radius`
+ * @param[in] radius the maximal offset of the neighbours along each dimension
+ * @param[in] f a functor taking a `StencilNeighbourhood` and returning the new value
+ * @param[in] options the extents of the tiles and the number of steps per tile
+ * @throws std::runtime_error if a tile and its halo do not fit in the scratch memory of a team
+ */
+template <
+        class ExecSpace,
+        concepts::borrowed_chunk OutChunk,
+        concepts::borrowed_chunk InChunk,
+        class... DDims,
+        class Functor>
+void parallel_stencil(
+        ExecSpace const& execution_space,
+        OutChunk&& out,
+        InChunk&& in,
+        DiscreteVector<DDims...> const& radius,
+        Functor const& f,
+        StencilOptions<DDims...> const& options)
+{
+    static_assert(is_writable_chunk_v<OutChunk>, "DDC: the output chunk must be writable");
+    assert(options.nsteps >= 1);
+    assert(((get<DDims>(options.tile) > 0) && ...));
+    [[maybe_unused]] DiscreteDomain<DDims...> const out_domain(out.domain());
+    assert(DiscreteDomain<DDims...>(in.domain())
+                   .restrict_with(DiscreteDomain<DDims...>(
+                           out_domain.front() - options.nsteps * radius,
+                           out_domain.extents() + 2 * options.nsteps * radius))
+           == DiscreteDomain<DDims...>(
+                   out_domain.front() - options.nsteps * radius,
+                   out_domain.extents() + 2 * options.nsteps * radius));
+    if (out.domain().empty()) {
+        return;
+    }
+    detail::StencilKernel<
+            ExecSpace,
+            decltype(out.span_view()),
+            decltype(in.span_cview()),
+            Functor,
+            DDims...> const kernel(out.span_view(), in.span_cview(), radius, f, options);
+    std::size_t const scratch_size = kernel.scratch_size();
+    std::size_t const scratch_size_max
+            = static_cast<std::size_t>(Kokkos::TeamPolicy<ExecSpace>::scratch_size_max(0));
+    if (scratch_size > scratch_size_max) {
+        throw std::runtime_error(
+                "DDC: parallel_stencil needs " + std::to_string(scratch_size)
+                + " bytes of scratch memory per team for a tile and its halo, only "
+                + std::to_string(scratch_size_max)
+                + " are available, reduce the tile extents or the number of steps");
+    }
+    Kokkos::parallel_for(
+            "ddc_parallel_stencil",
+            Kokkos::TeamPolicy<ExecSpace>(execution_space, kernel.league_size(), Kokkos::AUTO)
+                    .set_scratch_size(0, Kokkos::PerTeam(scratch_size)),
+            kernel);
+}
+
+/** Applies a stencil on each point of a domain with the default tiles, one step per tile
+ * @param[in] execution_space a Kokkos execution space where the loop will be executed on
+ * @param[out] out the borrowed chunk receiving the results, the stencil is applied on its domain
+ * @param[in] in the borrowed chunk the stencil reads, defined at least on the domain of `out`
+ *            extended by `radius`
+ * @param[in] radius the maximal offset of the neighbours along each dimension
+ * @param[in] f a functor taking a `StencilNeighbourhood` and returning the new value
+ */
+template <
+        class ExecSpace,
+        concepts::borrowed_chunk OutChunk,
+        concepts::borrowed_chunk InChunk,
+        class... DDims,
+        class Functor>
+void parallel_stencil(
+        ExecSpace const& execution_space,
+        OutChunk&& out,
+        InChunk&& in,
+        DiscreteVector<DDims...> const& radius,
+        Functor const& f)
+    requires(Kokkos::is_execution_space_v<ExecSpace>)
+{
+    parallel_stencil(
+            execution_space,
+            std::forward<OutChunk>(out),
+            std::forward<InChunk>(in),
+            radius,
+            f,
+            StencilOptions<DDims...> {default_stencil_tile<ExecSpace>(radius)});
+}
+
+/** Applies a stencil on each point of a domain using the `Kokkos` default execution space with
+ * the default tiles, one step per tile
+ * @param[out] out the borrowed chunk receiving the results, the stencil is applied on its domain
+ * @param[in] in the borrowed chunk the stencil reads, defined at least on the domain of `out`
+ *            extended by `radius`
+ * @param[in] radius the maximal offset of the neighbours along each dimension
+ * @param[in] f a functor taking a `StencilNeighbourhood` and returning the new value
+ */
+template <
+        concepts::borrowed_chunk OutChunk,
+        concepts::borrowed_chunk InChunk,
+        class... DDims,
+        class Functor>
+void parallel_stencil(
+        OutChunk&& out,
+        InChunk&& in,
+        DiscreteVector<DDims...> const& radius,
+        Functor const& f)
+{
+    parallel_stencil(
+            Kokkos::DefaultExecutionSpace(),
+            std::forward<OutChunk>(out),
+            std::forward<InChunk>(in),
+            radius,
+            f);
+}
+
+} // namespace ddc
@@ -4,15 +4,24 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
 #include <cstddef>
+#include <limits>
 #include <string>
 #include <type_traits>
 #include <utility>
 
 #include <Kokkos_Core.hpp>
 
+#include "detail/macros.hpp"
+
+#include "chunk_span.hpp"
 #include "chunk_traits.hpp"
 #include "ddc_to_kokkos_execution_policy.hpp"
+#include "discrete_domain.hpp"
 #include "discrete_vector.hpp"
 #include "reducer.hpp"
 
@@ -31,6 +40,15 @@ struct DdcToKokkosReducer<reducer::sum<T>, MemorySpace>
     using type = Kokkos::Sum<T, MemorySpace>;
 };
 
+template <class T, class MemorySpace>
+struct DdcToKokkosReducer<reducer::reproducible_sum<T>, MemorySpace>
+{
+    // Dependent on T so that it only fails when the specialization is instantiated
+    static_assert(
+            !std::is_same_v<T, T>,
+            "This reducer is only implemented by parallel_transform_reduce returning a value");
+};
+
 template <class T, class MemorySpace>
 struct DdcToKokkosReducer<reducer::prod<T>, MemorySpace>
 {
@@ -61,10 +79,57 @@ struct DdcToKokkosReducer<reducer::bor<T>, MemorySpace>
     using type = Kokkos::BOr<T, MemorySpace>;
 };
 
+/// Kokkos reducer computing the bitwise exclusive or, Kokkos does not provide one
+template <class T, class Space>
+class BXorKokkosReducer
+{
+    static_assert(std::is_integral_v<T>, "The bitwise exclusive or requires an integral type");
+
+public:
+    using reducer = BXorKokkosReducer;
+
+    using value_type = std::remove_cv_t<T>;
+
+    using result_view_type = Kokkos::View<value_type, Space, Kokkos::MemoryUnmanaged>;
+
+private:
+    result_view_type m_value;
+
+public:
+    KOKKOS_FUNCTION explicit BXorKokkosReducer(value_type& value) : m_value(&value) {}
+
+    KOKKOS_FUNCTION explicit BXorKokkosReducer(result_view_type const& value) : m_value(value) {}
+
+    KOKKOS_FUNCTION void join(value_type& dest, value_type const& src) const
+    {
+        dest ^= src;
+    }
+
+    KOKKOS_FUNCTION void init(value_type& val) const
+    {
+        val = value_type(0);
+    }
+
+    KOKKOS_FUNCTION value_type& reference() const
+    {
+        return *m_value.data();
+    }
+
+    KOKKOS_FUNCTION result_view_type view() const
+    {
+        return m_value;
+    }
+
+    KOKKOS_FUNCTION bool references_scalar() const
+    {
+        return true;
+    }
+};
+
 template <class T, class MemorySpace>
 struct DdcToKokkosReducer<reducer::bxor<T>, MemorySpace>
 {
-    static_assert(std::is_same_v<T, T>, "This reducer is not yet implemented");
+    using type = BXorKokkosReducer<T, MemorySpace>;
 };
 
 template <class T, class MemorySpace>
@@ -135,6 +200,265 @@ TransformReducerKokkosLambdaAdapter(Reducer const& r, Functor const& f, Support
                 Support,
                 std::make_index_sequence<Support::rank()>>;
 
+template <class Reducer>
+inline constexpr bool is_reproducible_sum_v = false;
+
+template <class T>
+inline constexpr bool is_reproducible_sum_v<reducer::reproducible_sum<T>> = true;
+
+/// Number of successive splittings of the values performed by the reproducible sum, each one
+/// adds approximately `digits - log2(n)` bits of accuracy
+inline constexpr std::size_t reproducible_sum_nfolds = 3;
+
+/// The partial sums of the reproducible sum, one per splitting
+template <class T>
+using reproducible_sum_folds = std::array<T, reproducible_sum_nfolds>;
+
+/// Kokkos reducer accumulating exactly the partial sums of the reproducible sum
+template <class T, class Space>
+class ReproducibleSumKokkosReducer
+{
+public:
+    using reducer = ReproducibleSumKokkosReducer;
+
+    using value_type = reproducible_sum_folds<T>;
+
+    using result_view_type = Kokkos::View<value_type, Space, Kokkos::MemoryUnmanaged>;
+
+private:
+    result_view_type m_value;
+
+public:
+    KOKKOS_FUNCTION explicit ReproducibleSumKokkosReducer(value_type& value) : m_value(&value) {}
+
+    KOKKOS_FUNCTION explicit ReproducibleSumKokkosReducer(result_view_type const& value)
+        : m_value(value)
+    {
+    }
+
+    // The partial sums are exact so that the order of the joins does not matter
+    KOKKOS_FUNCTION void join(value_type& dest, value_type const& src) const
+    {
+        for (std::size_t i = 0; i < reproducible_sum_nfolds; ++i) {
+            dest[i] += src[i];
+        }
+    }
+
+    KOKKOS_FUNCTION void init(value_type& val) const
+    {
+        for (std::size_t i = 0; i < reproducible_sum_nfolds; ++i) {
+            val[i] = T(0);
+        }
+    }
+
+    KOKKOS_FUNCTION value_type& reference() const
+    {
+        return *m_value.data();
+    }
+
+    KOKKOS_FUNCTION result_view_type view() const
+    {
+        return m_value;
+    }
+
+    KOKKOS_FUNCTION bool references_scalar() const
+    {
+        return true;
+    }
+};
+
+/// The smallest log2_n such that n <= 2^(log2_n - 1), sums of n terms then fit in the mantissa
+/// of a boundary 2^log2_n times larger than the terms
+inline int reproducible_sum_log2_n(std::size_t const n) noexcept
+{
+    return static_cast<int>(std::bit_width(n)) + 1;
+}
+
+/** Computes the power of two by which the terms of the reproducible sum are scaled down so that
+ * the largest boundary is finite
+ * @param[in] max_abs the maximum absolute value of the terms of the sum, must be finite
+ * @param[in] n the number of terms of the sum
+ * @return the exponent of the scaling, 0 unless the terms are close to the largest finite value
+ */
+template <class T>
+int reproducible_sum_scaling(T const max_abs, std::size_t const n)
+{
+    int exponent;
+    std::frexp(max_abs, &exponent);
+    return std::max(
+            0,
+            exponent + reproducible_sum_log2_n(n) - (std::numeric_limits<T>::max_exponent - 1));
+}
+
+/** Computes the boundaries used to split the values of the reproducible sum
+ * @param[in] max_abs the maximum absolute value of the terms of the sum, must be finite and such
+ *            that reproducible_sum_scaling(max_abs, n) is 0
+ * @param[in] n the number of terms of the sum
+ * @return the boundaries, the terms accumulated in each fold are multiples of the unit in the
+ *         last place of the corresponding boundary and their sum is exact
+ */
+template <class T>
+reproducible_sum_folds<T> reproducible_sum_boundaries(T const max_abs, std::size_t const n)
+{
+    // The terms are bounded by 2^exponent
+    int exponent;
+    std::frexp(max_abs, &exponent);
+    int const log2_n = reproducible_sum_log2_n(n);
+    reproducible_sum_folds<T> boundaries;
+    for (std::size_t i = 0; i < reproducible_sum_nfolds; ++i) {
+        if (exponent + log2_n < std::numeric_limits<T>::min_exponent) {
+            // The remaining terms are subnormal numbers whose sum is exact
+            boundaries[i] = T(0);
+        } else {
+            boundaries[i] = std::ldexp(T(1.5), exponent + log2_n);
+        }
+        // The remainders of the splitting are bounded by half the unit in the last place
+        exponent += log2_n - std::numeric_limits<T>::digits;
+    }
+    return boundaries;
+}
+
+template <class Functor>
+class AbsTransform
+{
+    Functor m_functor;
+
+public:
+    explicit AbsTransform(Functor const& f) : m_functor(f) {}
+
+    template <class DElem>
+    KOKKOS_FUNCTION auto operator()(DElem const& delem) const
+    {
+        return Kokkos::abs(m_functor(delem));
+    }
+};
+
+template <class T, class Functor, class Support, class IndexSequence>
+class ReproducibleSumKokkosLambdaAdapter
+{
+};
+
+template <class T, class Functor, class Support, std::size_t... Idx>
+class ReproducibleSumKokkosLambdaAdapter<T, Functor, Support, std::index_sequence<Idx...>>
+{
+    template <std::size_t I>
+    using index_type = DiscreteVectorElement;
+
+    Functor m_functor;
+
+    Support m_support;
+
+    reproducible_sum_folds<T> m_boundaries;
+
+    // The power of two scaling the terms, so that the boundaries are finite
+    T m_scale;
+
+    KOKKOS_FUNCTION void accumulate(T value, reproducible_sum_folds<T>& a) const
+    {
+        value *= m_scale;
+        for (std::size_t i = 0; i < reproducible_sum_nfolds; ++i) {
+            // Rounds `value` to a multiple of the unit in the last place of the boundary
+            T const rounded_value = (m_boundaries[i] + value) - m_boundaries[i];
+            a[i] += rounded_value;
+            value -= rounded_value;
+        }
+    }
+
+public:
+    ReproducibleSumKokkosLambdaAdapter(
+            Functor const& f,
+            Support const& support,
+            reproducible_sum_folds<T> const& boundaries,
+            T const scale)
+        : m_functor(f)
+        , m_support(support)
+        , m_boundaries(boundaries)
+        , m_scale(scale)
+    {
+    }
+
+    KOKKOS_FUNCTION void operator()(index_type<0> /*id*/, reproducible_sum_folds<T>& a) const
+        requires(sizeof...(Idx) == 0)
+    {
+        accumulate(m_functor(m_support(typename Support::discrete_vector_type())), a);
+    }
+
+    KOKKOS_FUNCTION void operator()(index_type<Idx>... ids, reproducible_sum_folds<T>& a) const
+        requires(sizeof...(Idx) > 0)
+    {
+        accumulate(m_functor(m_support(typename Support::discrete_vector_type(ids...))), a);
+    }
+};
+
+/** A parallel reproducible sum over a nD domain
+ * @param[in] label  name for easy identification of the parallel_for_each algorithm
+ * @param[in] execution_space a Kokkos execution space where the loop will be executed on
+ * @param[in] domain the range over which to apply the algorithm
+ * @param[in] neutral the neutral element of the reduction operation
+ * @param[in] transform a unary FunctionObject that will be applied to each element of the input
+ *            range. The return type must be acceptable as input to reduce
+ */
+template <class ExecSpace, class Support, class T, class ValueType, class UnaryTransformOp>
+T reproducible_sum_kokkos(
+        std::string const& label,
+        ExecSpace const& execution_space,
+        Support const& domain,
+        T const neutral,
+        reducer::reproducible_sum<ValueType> const& /*reduce*/,
+        UnaryTransformOp const& transform) noexcept
+{
+    auto const policy
+            = ddc_to_kokkos_execution_policy(execution_space, detail::array(domain.extents()));
+
+    ValueType max_abs = ValueType(0);
+    Kokkos::parallel_reduce(
+            label,
+            policy,
+            TransformReducerKokkosLambdaAdapter(
+                    reducer::max<ValueType>(),
+                    AbsTransform<UnaryTransformOp>(transform),
+                    domain),
+            Kokkos::Max<ValueType>(max_abs));
+    if (max_abs == ValueType(0)) {
+        return neutral;
+    }
+    if (!std::isfinite(max_abs)) {
+        // The result is not finite, there is nothing to reproduce
+        ValueType result = ValueType(0);
+        Kokkos::parallel_reduce(
+                label,
+                policy,
+                TransformReducerKokkosLambdaAdapter(reducer::sum<ValueType>(), transform, domain),
+                Kokkos::Sum<ValueType>(result));
+        return neutral + result;
+    }
+
+    // Terms close to the largest finite value are scaled down, the scaling by a power of two is
+    // exact unless it makes the smallest terms subnormal
+    int const scaling = reproducible_sum_scaling(max_abs, domain.size());
+    reproducible_sum_folds<ValueType> folds;
+    Kokkos::parallel_reduce(
+            label,
+            policy,
+            ReproducibleSumKokkosLambdaAdapter<
+                    ValueType,
+                    UnaryTransformOp,
+                    Support,
+                    std::make_index_sequence<Support::rank()>>(
+                    transform,
+                    domain,
+                    reproducible_sum_boundaries(std::ldexp(max_abs, -scaling), domain.size()),
+                    std::ldexp(ValueType(1), -scaling)),
+            ReproducibleSumKokkosReducer<ValueType, Kokkos::HostSpace>(folds));
+
+    // Combine the folds in a fixed order, starting from the smallest one
+    ValueType result = ValueType(0);
+    for (std::size_t i = reproducible_sum_nfolds; i-- > 0;) {
+        result += folds[i];
+    }
+    return neutral + std::ldexp(result, scaling);
+}
+
 /** A parallel reduction over a nD domain using the default Kokkos execution space
  * @param[in] label  name for easy identification of the parallel_for_each algorithm
  * @param[in] execution_space a Kokkos execution space where the loop will be executed on
@@ -154,13 +478,60 @@ T transform_reduce_kokkos(
         BinaryReductionOp const& reduce,
         UnaryTransformOp const& transform) noexcept
 {
-    T result = neutral;
+    DDC_IF_NVCC_THEN_PUSH_AND_SUPPRESS(implicit_return_from_non_void_function)
+    if constexpr (is_reproducible_sum_v<BinaryReductionOp>) {
+        return reproducible_sum_kokkos(label, execution_space, domain, neutral, reduce, transform);
+    } else {
+        T result = neutral;
+        Kokkos::parallel_reduce(
+                label,
+                ddc_to_kokkos_execution_policy(execution_space, detail::array(domain.extents())),
+                TransformReducerKokkosLambdaAdapter(reduce, transform, domain),
+                ddc_to_kokkos_reducer_t<BinaryReductionOp>(result));
+        return result;
+    }
+    DDC_IF_NVCC_THEN_POP
+}
+
+/** A parallel reduction over a nD domain storing the result in a rank-0 `Kokkos::View`
+ * @param[in] label  name for easy identification of the parallel_for_each algorithm
+ * @param[in] execution_space a Kokkos execution space where the loop will be executed on
+ * @param[in] domain the range over which to apply the algorithm
+ * @param[out] result a rank-0 `Kokkos::View` receiving the result of the reduction
+ * @param[in] reduce a binary FunctionObject that will be applied in unspecified order to the
+ *            results of transform, the results of other reduce and neutral.
+ * @param[in] transform a unary FunctionObject that will be applied to each element of the input
+ *            range. The return type must be acceptable as input to reduce
+ */
+template <
+        class ExecSpace,
+        class Support,
+        class ResultView,
+        class BinaryReductionOp,
+        class UnaryTransformOp>
+void transform_reduce_kokkos_to_view(
+        std::string const& label,
+        ExecSpace const& execution_space,
+        Support const& domain,
+        ResultView const& result,
+        BinaryReductionOp const& reduce,
+        UnaryTransformOp const& transform) noexcept
+{
+    static_assert(ResultView::rank() == 0, "The result must be a rank-0 view");
+    static_assert(
+            std::is_same_v<
+                    typename ResultView::non_const_value_type,
+                    typename BinaryReductionOp::value_type>,
+            "The result must store values of type BinaryReductionOp::value_type");
+    static_assert(
+            Kokkos::SpaceAccessibility<ExecSpace, typename ResultView::memory_space>::accessible,
+            "The result must be accessible from the execution space");
     Kokkos::parallel_reduce(
             label,
             ddc_to_kokkos_execution_policy(execution_space, detail::array(domain.extents())),
             TransformReducerKokkosLambdaAdapter(reduce, transform, domain),
-            ddc_to_kokkos_reducer_t<BinaryReductionOp>(result));
-    return result;
+            ddc_to_kokkos_reducer_t<BinaryReductionOp, typename ResultView::memory_space>(
+                    result));
 }
 
 } // namespace detail
@@ -270,6 +641,148 @@ T parallel_transform_reduce(
             std::forward<UnaryTransformOp>(transform));
 }
 
+/** A reduction over a nD domain using a given `Kokkos` execution space, the result is written
+ * into a rank-0 ChunkSpan without waiting for the completion of the kernel. The result can be
+ * used directly by subsequent kernels enqueued on the same execution space.
+ * @param[in] label  name for easy identification of the parallel_for_each algorithm
+ * @param[in] execution_space a Kokkos execution space where the loop will be executed on
+ * @param[in] domain the range over which to apply the algorithm
+ * @param[out] result a rank-0 ChunkSpan accessible from `execution_space` receiving the result
+ * @param[in] reduce a binary FunctionObject that will be applied in unspecified order to the
+ *            results of transform, the results of other reduce and neutral.
+ * @param[in] transform a unary FunctionObject that will be applied to each element of the input
+ *            range. The return type must be acceptable as input to reduce
+ */
+template <
+        class ExecSpace,
+        class Support,
+        class ElementType,
+        class Layout,
+        class MemorySpace,
+        class BinaryReductionOp,
+        class UnaryTransformOp>
+void parallel_transform_reduce(
+        std::string const& label,
+        ExecSpace const& execution_space,
+        Support const& domain,
+        ChunkSpan<ElementType, DiscreteDomain<>, Layout, MemorySpace> const& result,
+        BinaryReductionOp&& reduce,
+        UnaryTransformOp&& transform) noexcept
+{
+    detail::transform_reduce_kokkos_to_view(
+            label,
+            execution_space,
+            domain,
+            result.allocation_kokkos_view(),
+            std::forward<BinaryReductionOp>(reduce),
+            std::forward<UnaryTransformOp>(transform));
+}
+
+/** A reduction over a nD domain using a given `Kokkos` execution space, the result is written
+ * into a rank-0 ChunkSpan without waiting for the completion of the kernel.
+ * @param[in] execution_space a Kokkos execution space where the loop will be executed on
+ * @param[in] domain the range over which to apply the algorithm
+ * @param[out] result a rank-0 ChunkSpan accessible from `execution_space` receiving the result
+ * @param[in] reduce a binary FunctionObject that will be applied in unspecified order to the
+ *            results of transform, the results of other reduce and neutral.
+ * @param[in] transform a unary FunctionObject that will be applied to each element of the input
+ *            range. The return type must be acceptable as input to reduce
+ */
+template <
+        class ExecSpace,
+        class Support,
+        class ElementType,
+        class Layout,
+        class MemorySpace,
+        class BinaryReductionOp,
+        class UnaryTransformOp>
+void parallel_transform_reduce(
+        ExecSpace const& execution_space,
+        Support const& domain,
+        ChunkSpan<ElementType, DiscreteDomain<>, Layout, MemorySpace> const& result,
+        BinaryReductionOp&& reduce,
+        UnaryTransformOp&& transform) noexcept
+    requires(Kokkos::is_execution_space_v<ExecSpace>)
+{
+    detail::transform_reduce_kokkos_to_view(
+            "ddc_parallel_transform_reduce_default",
+            execution_space,
+            domain,
+            result.allocation_kokkos_view(),
+            std::forward<BinaryReductionOp>(reduce),
+            std::forward<UnaryTransformOp>(transform));
+}
+
+/** A reduction over a nD domain using a given `Kokkos` execution space, the result is written
+ * into a rank-0 `Kokkos::View` without waiting for the completion of the kernel. The result can
+ * be used directly by subsequent kernels enqueued on the same execution space.
+ * @param[in] label  name for easy identification of the parallel_for_each algorithm
+ * @param[in] execution_space a Kokkos execution space where the loop will be executed on
+ * @param[in] domain the range over which to apply the algorithm
+ * @param[out] result a rank-0 `Kokkos::View` accessible from `execution_space` receiving the result
+ * @param[in] reduce a binary FunctionObject that will be applied in unspecified order to the
+ *            results of transform, the results of other reduce and neutral.
+ * @param[in] transform a unary FunctionObject that will be applied to each element of the input
+ *            range. The return type must be acceptable as input to reduce
+ */
+template <
+        class ExecSpace,
+        class Support,
+        class DataType,
+        class... Properties,
+        class BinaryReductionOp,
+        class UnaryTransformOp>
+void parallel_transform_reduce(
+        std::string const& label,
+        ExecSpace const& execution_space,
+        Support const& domain,
+        Kokkos::View<DataType, Properties...> const& result,
+        BinaryReductionOp&& reduce,
+        UnaryTransformOp&& transform) noexcept
+{
+    detail::transform_reduce_kokkos_to_view(
+            label,
+            execution_space,
+            domain,
+            result,
+            std::forward<BinaryReductionOp>(reduce),
+            std::forward<UnaryTransformOp>(transform));
+}
+
+/** A reduction over a nD domain using a given `Kokkos` execution space, the result is written
+ * into a rank-0 `Kokkos::View` without waiting for the completion of the kernel.
+ * @param[in] execution_space a Kokkos execution space where the loop will be executed on
+ * @param[in] domain the range over which to apply the algorithm
+ * @param[out] result a rank-0 `Kokkos::View` accessible from `execution_space` receiving the result
+ * @param[in] reduce a binary FunctionObject that will be applied in unspecified order to the
+ *            results of transform, the results of other reduce and neutral.
+ * @param[in] transform a unary FunctionObject that will be applied to each element of the input
+ *            range. The return type must be acceptable as input to reduce
+ */
+template <
+        class ExecSpace,
+        class Support,
+        class DataType,
+        class... Properties,
+        class BinaryReductionOp,
+        class UnaryTransformOp>
+void parallel_transform_reduce(
+        ExecSpace const& execution_space,
+        Support const& domain,
+        Kokkos::View<DataType, Properties...> const& result,
+        BinaryReductionOp&& reduce,
+        UnaryTransformOp&& transform) noexcept
+    requires(Kokkos::is_execution_space_v<ExecSpace>)
+{
+    detail::transform_reduce_kokkos_to_view(
+            "ddc_parallel_transform_reduce_default",
+            execution_space,
+            domain,
+            result,
+            std::forward<BinaryReductionOp>(reduce),
+            std::forward<UnaryTransformOp>(transform));
+}
+
 namespace experimental {
 
 namespace detail {
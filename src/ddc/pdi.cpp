@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: MIT
 
 #include <cstring>
+#include <functional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -31,6 +32,9 @@ PdiEvent::~PdiEvent() noexcept
     for (std::string const& one_name : m_names) {
         PDI_reclaim(one_name.c_str());
     }
+    for (std::function<void()> const& copy_back : m_copy_backs) {
+        copy_back();
+    }
 }
 
 PdiEvent& PdiEvent::with(std::string const& name, char const* const c_string)
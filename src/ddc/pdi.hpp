@@ -7,6 +7,7 @@
 #include <any>
 #include <array>
 #include <cstddef>
+#include <functional>
 #include <list>
 #include <string>
 #include <type_traits>
@@ -36,6 +37,11 @@ class PdiEvent
 
     std::list<std::any> m_metadata;
 
+    std::list<detail::StagingBuffer> m_staging_buffers;
+
+    // copies of the staged data back to the device, run after the event
+    std::vector<std::function<void()>> m_copy_backs;
+
     char const* store_name(std::string&& name);
 
     char const* store_name(std::string const& name);
@@ -82,10 +88,27 @@ public:
                 store_name(name + "_extents"),
                 store_array(std::vector<std::size_t>(extents.begin(), extents.end())),
                 PDI_OUT);
-        PDI_share(
-                store_name(name),
-                const_cast<chunk_value_t<BorrowedChunk>*>(data.data_handle()),
-                Access);
+        using chunk_type = std::remove_cvref_t<BorrowedChunk>;
+        if constexpr (Kokkos::SpaceAccessibility<
+                              Kokkos::HostSpace,
+                              typename chunk_type::memory_space>::accessible) {
+            PDI_share(
+                    store_name(name),
+                    const_cast<chunk_value_t<BorrowedChunk>*>(data.data_handle()),
+                    Access);
+        } else {
+            // data not accessible from the host is exposed through a copy in a staging buffer
+            static_assert(
+                    std::is_same_v<typename chunk_type::layout_type, Kokkos::layout_right>,
+                    "DDC: only layout right chunks can be exposed from the device");
+            auto const staged
+                    = detail::stage_to_host(m_staging_buffers.emplace_back(), data.span_cview());
+            if constexpr (Access & PDI_IN) {
+                m_copy_backs.emplace_back(
+                        [staged, dst = data.span_view()] { parallel_deepcopy(dst, staged); });
+            }
+            PDI_share(store_name(name), staged.data_handle(), Access);
+        }
         return *this;
     }
 
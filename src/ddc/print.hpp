@@ -20,6 +20,7 @@
 #include "chunk_span.hpp"
 #include "create_mirror.hpp"
 #include "discrete_vector.hpp"
+#include "staging_buffer.hpp"
 
 namespace ddc {
 
@@ -352,33 +353,34 @@ std::ostream& print_content(
         ChunkSpan<ElementType, SupportType, LayoutStridedPolicy, MemorySpace> const& chunk_span)
 {
     auto chunk_span_right = detail::create_layout_right_view_and_copy(chunk_span);
-    auto chunk_span_right_host
-            = create_mirror_view_and_copy(Kokkos::HostSpace(), chunk_span_right.span_view());
 
-    using chunkspan_type
-            = std::remove_cv_t<std::remove_reference_t<decltype(chunk_span_right_host)>>;
-    using mdspan_type = chunkspan_type::allocation_mdspan_type;
-    using extents = mdspan_type::extents_type;
+    return detail::with_host_staging(
+            chunk_span_right.span_view(),
+            [&](auto const& chunk_span_right_host) -> std::ostream& {
+                using chunkspan_type = std::remove_cvref_t<decltype(chunk_span_right_host)>;
+                using mdspan_type = chunkspan_type::allocation_mdspan_type;
+                using extents = mdspan_type::extents_type;
 
-    mdspan_type const allocated_mdspan = chunk_span_right_host.allocation_mdspan();
+                mdspan_type const allocated_mdspan = chunk_span_right_host.allocation_mdspan();
 
-    ddc::detail::ChunkPrinter& printer = ddc::detail::ChunkPrinter::get_instance();
-    std::scoped_lock const lock(printer.m_global_lock);
+                ddc::detail::ChunkPrinter& printer = ddc::detail::ChunkPrinter::get_instance();
+                std::scoped_lock const lock(printer.m_global_lock);
 
-    printer.saveformat(os);
+                printer.saveformat(os);
 
-    std::size_t const largest_element = printer.find_largest_displayed_element(
-            allocated_mdspan,
-            std::make_index_sequence<extents::rank()>());
+                std::size_t const largest_element = printer.find_largest_displayed_element(
+                        allocated_mdspan,
+                        std::make_index_sequence<extents::rank()>());
 
-    printer.print_impl(
-            os,
-            allocated_mdspan,
-            0 /*level*/,
-            largest_element,
-            std::make_index_sequence<extents::rank()>());
+                printer.print_impl(
+                        os,
+                        allocated_mdspan,
+                        0 /*level*/,
+                        largest_element,
+                        std::make_index_sequence<extents::rank()>());
 
-    return os;
+                return os;
+            });
 }
 
 /**
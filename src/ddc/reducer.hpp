@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <type_traits>
 #include <utility>
 
 #include <Kokkos_Macros.hpp>
@@ -22,6 +23,28 @@ struct sum
     }
 };
 
+/** A sum whose result is bitwise reproducible when used with `ddc::parallel_transform_reduce`,
+ * whatever the execution space, the number of threads or the order of the operations.
+ *
+ * The values are split on a grid of decreasing boundaries deduced from the maximum absolute
+ * value so that the sum of each part is exact, see J. Demmel and H. D. Nguyen, "Fast
+ * Reproducible Floating-Point Summation", ARITH 2013. It requires an additional pass over the
+ * domain and is not compatible with value-unsafe compiler optimizations like `-ffast-math`.
+ */
+template <class T>
+struct reproducible_sum
+{
+    static_assert(std::is_floating_point_v<T>, "Only floating-point types are supported");
+
+    using value_type = T;
+
+    KOKKOS_FUNCTION constexpr value_type operator()(value_type const& lhs, value_type const& rhs)
+            const noexcept
+    {
+        return lhs + rhs;
+    }
+};
+
 template <class T>
 struct prod
 {
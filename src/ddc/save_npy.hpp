@@ -17,6 +17,7 @@
 
 #include "chunk_span.hpp"
 #include "create_mirror.hpp"
+#include "staging_buffer.hpp"
 
 namespace ddc::detail {
 
@@ -124,10 +125,9 @@ void save_npy(
         ChunkSpan<T, SupportType, LayoutStridedPolicy, MemorySpace> const& chunk_span)
 {
     auto chunk_span_right = ::ddc::detail::create_layout_right_view_and_copy(chunk_span);
-    auto chunk_span_right_host
-            = create_mirror_view_and_copy(Kokkos::HostSpace(), chunk_span_right.span_view());
-    ddc::detail::
-            save_npy(os, ddc::detail::to_np_array_view(chunk_span_right_host.allocation_mdspan()));
+    ddc::detail::with_host_staging(chunk_span_right.span_view(), [&](auto const& host_span) {
+        ddc::detail::save_npy(os, ddc::detail::to_np_array_view(host_span.allocation_mdspan()));
+    });
 }
 
 /**
@@ -142,11 +142,11 @@ void save_npy(
         ChunkSpan<T, SupportType, LayoutStridedPolicy, MemorySpace> const& chunk_span)
 {
     auto chunk_span_right = ::ddc::detail::create_layout_right_view_and_copy(chunk_span);
-    auto chunk_span_right_host
-            = create_mirror_view_and_copy(Kokkos::HostSpace(), chunk_span_right.span_view());
-    ddc::detail::save_npy(
-            filename,
-            ddc::detail::to_np_array_view(chunk_span_right_host.allocation_mdspan()));
+    ddc::detail::with_host_staging(chunk_span_right.span_view(), [&](auto const& host_span) {
+        ddc::detail::save_npy(
+                filename,
+                ddc::detail::to_np_array_view(host_span.allocation_mdspan()));
+    });
 }
 
 } // namespace ddc::experimental
@@ -9,7 +9,9 @@
 #include <utility>
 
 #include "discrete_space.hpp"
+#include "memory_accounting.hpp"
 #include "scope_guard.hpp"
+#include "staging_buffer.hpp"
 
 namespace {
 
@@ -26,6 +28,7 @@ namespace ddc {
 ScopeGuard::ScopeGuard()
 {
     discretization_store_initialization();
+    detail::initialize_staging_pool();
 }
 
 ScopeGuard::ScopeGuard(int /*argc*/, char**& /*argv*/) : ScopeGuard() {}
@@ -36,6 +39,8 @@ ScopeGuard::~ScopeGuard() noexcept
         fn();
     }
     detail::g_discretization_store.reset();
+    detail::finalize_staging_pool();
+    detail::print_memory_report_if_requested();
 }
 
 } // namespace ddc
@@ -0,0 +1,207 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <set>
+#include <tuple>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include "kokkos_allocator.hpp"
+#include "staging_buffer.hpp"
+
+namespace {
+
+class StagingPool
+{
+    std::mutex m_mutex;
+
+    // the available buffers sorted by size
+    std::multimap<std::size_t, void*> m_buffers;
+
+    // the total size of the available buffers in bytes
+    std::size_t m_nbytes = 0;
+
+    // the maximal total size of the available buffers in bytes
+    std::size_t m_capacity = ddc::detail::default_staging_pool_capacity;
+
+    // the borrowed buffers that return to the pool, the others are freed on their return
+    std::set<void*> m_borrowed;
+
+    // whether DDC is finalized, in which case no buffer returns to the pool
+    bool m_finalized = false;
+
+    // frees the largest available buffers until their total size fits in the capacity, the
+    // mutex must be held
+    void shrink_to_capacity()
+    {
+        while (m_nbytes > m_capacity) {
+            auto const it = std::prev(m_buffers.end());
+            Kokkos::kokkos_free<ddc::PinnedHostSpace>(it->second);
+            m_nbytes -= it->first;
+            m_buffers.erase(it);
+        }
+    }
+
+public:
+    std::pair<void*, std::size_t> acquire(std::size_t const nbytes)
+    {
+        {
+            std::scoped_lock const lock(m_mutex);
+            auto const it = m_buffers.lower_bound(nbytes);
+            if (it != m_buffers.end()) {
+                std::pair<void*, std::size_t> const buffer(it->second, it->first);
+                m_nbytes -= it->first;
+                m_buffers.erase(it);
+                m_borrowed.insert(buffer.first);
+                return buffer;
+            }
+        }
+        void* const ptr = Kokkos::kokkos_malloc<ddc::PinnedHostSpace>("ddc_staging_buffer", nbytes);
+        std::scoped_lock const lock(m_mutex);
+        if (!m_finalized) {
+            m_borrowed.insert(ptr);
+        }
+        return std::pair(ptr, nbytes);
+    }
+
+    void release(void* const ptr, std::size_t const nbytes)
+    {
+        std::scoped_lock const lock(m_mutex);
+        if (m_borrowed.erase(ptr) == 1) {
+            m_buffers.emplace(nbytes, ptr);
+            m_nbytes += nbytes;
+            shrink_to_capacity();
+        } else {
+            Kokkos::kokkos_free<ddc::PinnedHostSpace>(ptr);
+        }
+    }
+
+    std::size_t size()
+    {
+        std::scoped_lock const lock(m_mutex);
+        return m_buffers.size();
+    }
+
+    std::size_t nbytes()
+    {
+        std::scoped_lock const lock(m_mutex);
+        return m_nbytes;
+    }
+
+    std::size_t capacity()
+    {
+        std::scoped_lock const lock(m_mutex);
+        return m_capacity;
+    }
+
+    void set_capacity(std::size_t const capacity)
+    {
+        std::scoped_lock const lock(m_mutex);
+        m_capacity = capacity;
+        shrink_to_capacity();
+    }
+
+    void clear()
+    {
+        std::scoped_lock const lock(m_mutex);
+        for (auto const& [nbytes, ptr] : m_buffers) {
+            Kokkos::kokkos_free<ddc::PinnedHostSpace>(ptr);
+        }
+        m_buffers.clear();
+        m_nbytes = 0;
+        m_borrowed.clear();
+    }
+
+    void set_finalized(bool const finalized)
+    {
+        std::scoped_lock const lock(m_mutex);
+        m_finalized = finalized;
+    }
+};
+
+// Never destroyed, the buffers must be freed before Kokkos is finalized
+StagingPool& staging_pool()
+{
+    static StagingPool* const s_pool = new StagingPool();
+    return *s_pool;
+}
+
+} // namespace
+
+namespace ddc::detail {
+
+StagingBuffer::StagingBuffer(std::size_t const nbytes)
+{
+    if (nbytes != 0) {
+        std::tie(m_ptr, m_size) = staging_pool().acquire(nbytes);
+    }
+}
+
+StagingBuffer::StagingBuffer(StagingBuffer&& other) noexcept
+    : m_ptr(std::exchange(other.m_ptr, nullptr))
+    , m_size(std::exchange(other.m_size, 0))
+{
+}
+
+StagingBuffer::~StagingBuffer() noexcept
+{
+    if (m_ptr != nullptr) {
+        staging_pool().release(m_ptr, m_size);
+    }
+}
+
+StagingBuffer& StagingBuffer::operator=(StagingBuffer&& other) noexcept
+{
+    if (this != &other) {
+        if (m_ptr != nullptr) {
+            staging_pool().release(m_ptr, m_size);
+        }
+        m_ptr = std::exchange(other.m_ptr, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+    }
+    return *this;
+}
+
+std::size_t staging_pool_size()
+{
+    return staging_pool().size();
+}
+
+std::size_t staging_pool_nbytes()
+{
+    return staging_pool().nbytes();
+}
+
+std::size_t staging_pool_capacity()
+{
+    return staging_pool().capacity();
+}
+
+void set_staging_pool_capacity(std::size_t const capacity)
+{
+    staging_pool().set_capacity(capacity);
+}
+
+void clear_staging_pool() noexcept
+{
+    staging_pool().clear();
+}
+
+void initialize_staging_pool() noexcept
+{
+    staging_pool().set_finalized(false);
+}
+
+void finalize_staging_pool() noexcept
+{
+    staging_pool().set_finalized(true);
+    staging_pool().clear();
+}
+
+} // namespace ddc::detail
@@ -0,0 +1,132 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include "chunk_span.hpp"
+#include "kokkos_allocator.hpp"
+#include "parallel_deepcopy.hpp"
+
+namespace ddc {
+
+namespace detail {
+
+/** A buffer of `PinnedHostSpace` memory borrowed from a pool shared by the whole program
+ *
+ * The buffers are returned to the pool on destruction and reused by the next transfers
+ * instead of being reallocated, page-locked allocations being much more expensive than
+ * pageable ones. The pool is emptied when DDC is finalized, the buffers still borrowed at
+ * that time and the ones borrowed afterwards being freed on destruction.
+ *
+ * Page-locked memory being scarce, the total size of the buffers available in the pool is
+ * bounded by a capacity, see `set_staging_pool_capacity`: when a returned buffer exceeds it, the
+ * largest available buffers are freed until the pool fits again.
+ */
+class StagingBuffer
+{
+    void* m_ptr = nullptr;
+
+    std::size_t m_size = 0;
+
+public:
+    /// Empty buffer
+    StagingBuffer() = default;
+
+    /** Borrow a buffer from the pool, allocating one if none is large enough
+     * @param[in] nbytes the minimal size of the buffer in bytes
+     */
+    explicit StagingBuffer(std::size_t nbytes);
+
+    StagingBuffer(StagingBuffer const& other) = delete;
+
+    StagingBuffer(StagingBuffer&& other) noexcept;
+
+    ~StagingBuffer() noexcept;
+
+    StagingBuffer& operator=(StagingBuffer const& other) = delete;
+
+    StagingBuffer& operator=(StagingBuffer&& other) noexcept;
+
+    void* data() const noexcept
+    {
+        return m_ptr;
+    }
+
+    /// @return the size of the buffer in bytes, possibly larger than requested
+    std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+};
+
+/// The default maximal total size in bytes of the buffers available in the staging pool
+inline constexpr std::size_t default_staging_pool_capacity = std::size_t(256) << 20;
+
+/// @return the number of buffers currently available in the staging pool
+std::size_t staging_pool_size();
+
+/// @return the total size in bytes of the buffers currently available in the staging pool
+std::size_t staging_pool_nbytes();
+
+/// @return the maximal total size in bytes of the buffers available in the staging pool
+std::size_t staging_pool_capacity();
+
+/// Sets the maximal total size in bytes of the buffers available in the staging pool, freeing
+/// the largest available buffers if they exceed it
+void set_staging_pool_capacity(std::size_t capacity);
+
+/// Frees the available buffers of the staging pool, the borrowed ones are freed on their return
+void clear_staging_pool() noexcept;
+
+/// Makes the borrowed buffers return to the staging pool, called when DDC is initialized
+void initialize_staging_pool() noexcept;
+
+/// Clears the staging pool and frees all the buffers on their return, called when DDC is finalized
+void finalize_staging_pool() noexcept;
+
+/** Copy a layout right ChunkSpan into a staging buffer
+ * @param[out] buffer the buffer receiving the values, replaced by a large enough one
+ * @param[in] src the ChunkSpan to copy
+ * @return a ChunkSpan on the copy, valid as long as `buffer` is
+ */
+template <class ElementType, class SupportType, class MemorySpace>
+auto stage_to_host(
+        StagingBuffer& buffer,
+        ChunkSpan<ElementType, SupportType, Kokkos::layout_right, MemorySpace> const& src)
+{
+    using value_type = std::remove_const_t<ElementType>;
+    buffer = StagingBuffer(src.size() * sizeof(value_type));
+    ChunkSpan<value_type, SupportType, Kokkos::layout_right, PinnedHostSpace> const
+            staged(static_cast<value_type*>(buffer.data()), src.domain());
+    parallel_deepcopy(staged, src);
+    return staged;
+}
+
+/** Call `f` on a host accessible version of a layout right ChunkSpan
+ *
+ * `src` is given directly if it is accessible from the host, otherwise it is copied into a
+ * staging buffer for the duration of the call.
+ */
+template <class ElementType, class SupportType, class MemorySpace, class Functor>
+decltype(auto) with_host_staging(
+        ChunkSpan<ElementType, SupportType, Kokkos::layout_right, MemorySpace> const& src,
+        Functor&& f)
+{
+    if constexpr (Kokkos::SpaceAccessibility<Kokkos::HostSpace, MemorySpace>::accessible) {
+        return std::forward<Functor>(f)(src);
+    } else {
+        StagingBuffer buffer;
+        return std::forward<Functor>(f)(stage_to_host(buffer, src).span_cview());
+    }
+}
+
+} // namespace detail
+
+} // namespace ddc
@@ -0,0 +1,208 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include <Kokkos_Core.hpp>
+
+#include "detail/macros.hpp"
+#include "detail/type_seq.hpp"
+
+#include "discrete_domain.hpp"
+#include "discrete_element.hpp"
+#include "discrete_vector.hpp"
+
+namespace ddc {
+
+template <class SupportType, std::size_t... Extents>
+class StaticDiscreteDomain;
+
+template <class T>
+struct is_static_discrete_domain : std::false_type
+{
+};
+
+template <class SupportType, std::size_t... Extents>
+struct is_static_discrete_domain<StaticDiscreteDomain<SupportType, Extents...>> : std::true_type
+{
+};
+
+template <class T>
+inline constexpr bool is_static_discrete_domain_v = is_static_discrete_domain<T>::value;
+
+/// A StaticDiscreteDomain is a DiscreteDomain with some compile-time extents
+template <class... DDims, std::size_t... Extents>
+struct is_discrete_domain<StaticDiscreteDomain<DiscreteDomain<DDims...>, Extents...>>
+    : std::true_type
+{
+};
+
+namespace detail {
+
+/// A StaticDiscreteDomain with the given extents, or a DiscreteDomain if none of them is static
+template <class SupportType, std::size_t... Extents>
+struct StaticDiscreteDomainOrDynamic
+{
+    using type = std::conditional_t<
+            ((Extents == Kokkos::dynamic_extent) && ...),
+            SupportType,
+            StaticDiscreteDomain<SupportType, Extents...>>;
+};
+
+template <class... DDims, std::size_t... Extents>
+struct ToTypeSeq<StaticDiscreteDomain<DiscreteDomain<DDims...>, Extents...>>
+{
+    using type = TypeSeq<DDims...>;
+};
+
+/// The static extent of `QueryDDim` in a StaticDiscreteDomain, dynamic if it is not one of its
+/// dimensions
+template <class QueryDDim, class SupportType, std::size_t... Extents>
+struct StaticExtentOf;
+
+template <class QueryDDim, class... DDims, std::size_t... Extents>
+struct StaticExtentOf<QueryDDim, DiscreteDomain<DDims...>, Extents...>
+{
+    static constexpr std::size_t value
+            = in_tags_v<QueryDDim, TypeSeq<DDims...>>
+                      ? ((std::is_same_v<QueryDDim, DDims> ? Extents : 0) + ...)
+                      : Kokkos::dynamic_extent;
+};
+
+/// Rebinding keeps the static extents of the dimensions that remain
+template <class... DDims, std::size_t... Extents, class... ODDims>
+struct Rebind<StaticDiscreteDomain<DiscreteDomain<DDims...>, Extents...>, TypeSeq<ODDims...>>
+{
+    using type = StaticDiscreteDomainOrDynamic<
+            DiscreteDomain<ODDims...>,
+            StaticExtentOf<ODDims, DiscreteDomain<DDims...>, Extents...>::value...>::type;
+};
+
+} // namespace detail
+
+/** A DiscreteDomain some of whose extents are known at compile time
+ *
+ * The static extents are propagated to the `extents_type` of the Chunk and ChunkSpan defined on
+ * this domain, so that the index computations along these dimensions use compile-time strides
+ * and the loops over them can be unrolled. `Kokkos::dynamic_extent` marks a dimension whose
+ * extent is only known at runtime, e.g. `StaticDiscreteDomain<DiscreteDomain<DDimX, DDimV>,
+ * Kokkos::dynamic_extent, 3>` for 3 velocity components at each point along X.
+ *
+ * The operations returning a new domain (restrict_with, remove, take_first...) return a plain
+ * DiscreteDomain, slicing out some dimensions of a ChunkSpan keeps the static extents of the
+ * remaining ones.
+ *
+ * @tparam SupportType a `DiscreteDomain` on the dimensions of the domain
+ * @tparam Extents the extent along each dimension, or `Kokkos::dynamic_extent`
+ */
+template <class... DDims, std::size_t... Extents>
+class StaticDiscreteDomain<DiscreteDomain<DDims...>, Extents...> : public DiscreteDomain<DDims...>
+{
+    static_assert(
+            sizeof...(DDims) == sizeof...(Extents),
+            "DDC: StaticDiscreteDomain expects one extent per dimension");
+
+    static_assert(sizeof...(DDims) > 0, "DDC: StaticDiscreteDomain expects at least a dimension");
+
+    using base_type = DiscreteDomain<DDims...>;
+
+public:
+    using discrete_element_type = base_type::discrete_element_type;
+
+    using discrete_vector_type = base_type::discrete_vector_type;
+
+    /// The extents of the mdspan on a chunk defined on this domain
+    using static_extents_type = Kokkos::extents<std::size_t, Extents...>;
+
+    static KOKKOS_FUNCTION constexpr std::size_t static_extent(std::size_t r) noexcept
+    {
+        return static_extents_type::static_extent(r);
+    }
+
+    KOKKOS_DEFAULTED_FUNCTION StaticDiscreteDomain() = default;
+
+    /** Construct a StaticDiscreteDomain by copies and merge of domains
+     *
+     * The extents of the domains along the static dimensions must match the static extents.
+     */
+    template <concepts::discrete_domain... DDoms>
+    KOKKOS_FUNCTION constexpr explicit StaticDiscreteDomain(DDoms const&... domains)
+        : base_type(domains...)
+    {
+        KOKKOS_ASSERT(has_static_extents(base_type::extents()))
+    }
+
+    /** Construct a StaticDiscreteDomain starting from element_begin with size points
+     * @param element_begin the lower bound in each direction
+     * @param size the number of points in each direction, must match the static extents
+     */
+    KOKKOS_FUNCTION constexpr StaticDiscreteDomain(
+            discrete_element_type const& element_begin,
+            discrete_vector_type const& size)
+        : base_type(element_begin, size)
+    {
+        KOKKOS_ASSERT(has_static_extents(size))
+    }
+
+    /** Construct a StaticDiscreteDomain starting from element_begin, all extents being static
+     * @param element_begin the lower bound in each direction
+     */
+    KOKKOS_FUNCTION constexpr explicit StaticDiscreteDomain(
+            discrete_element_type const& element_begin)
+        requires((Extents != Kokkos::dynamic_extent) && ...)
+        : base_type(
+                  element_begin,
+                  discrete_vector_type(static_cast<DiscreteVectorElement>(Extents)...))
+    {
+    }
+
+    KOKKOS_DEFAULTED_FUNCTION StaticDiscreteDomain(StaticDiscreteDomain const& x) = default;
+
+    KOKKOS_DEFAULTED_FUNCTION StaticDiscreteDomain(StaticDiscreteDomain&& x) = default;
+
+    KOKKOS_DEFAULTED_FUNCTION ~StaticDiscreteDomain() = default;
+
+    KOKKOS_DEFAULTED_FUNCTION StaticDiscreteDomain& operator=(StaticDiscreteDomain const& x)
+            = default;
+
+    KOKKOS_DEFAULTED_FUNCTION StaticDiscreteDomain& operator=(StaticDiscreteDomain&& x) = default;
+
+    KOKKOS_FUNCTION constexpr std::size_t size() const
+    {
+        return (1UL * ... * extent<DDims>().value());
+    }
+
+    KOKKOS_FUNCTION constexpr discrete_vector_type extents() const noexcept
+    {
+        return discrete_vector_type(extent<DDims>()...);
+    }
+
+    template <class QueryDDim>
+    KOKKOS_FUNCTION constexpr DiscreteVector<QueryDDim> extent() const noexcept
+    {
+        DDC_IF_NVCC_THEN_PUSH_AND_SUPPRESS(implicit_return_from_non_void_function)
+        constexpr std::size_t n
+                = static_extent(type_seq_rank_v<QueryDDim, detail::TypeSeq<DDims...>>);
+        if constexpr (n == Kokkos::dynamic_extent) {
+            return base_type::template extent<QueryDDim>();
+        } else {
+            return DiscreteVector<QueryDDim>(static_cast<DiscreteVectorElement>(n));
+        }
+        DDC_IF_NVCC_THEN_POP
+    }
+
+private:
+    static KOKKOS_FUNCTION constexpr bool has_static_extents(
+            discrete_vector_type const& size) noexcept
+    {
+        return ((Extents == Kokkos::dynamic_extent
+                 || static_cast<std::size_t>(get<DDims>(size)) == Extents)
+                && ...);
+    }
+};
+
+} // namespace ddc
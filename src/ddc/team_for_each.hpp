@@ -0,0 +1,96 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include <Kokkos_Core.hpp>
+
+#include "discrete_vector.hpp"
+
+namespace ddc {
+
+namespace detail {
+
+/** Returns the element of a nD domain at a given linear index, enumerated in the row-major order
+ * @param[in] domain the domain
+ * @param[in] size   the extents of the domain
+ * @param[in] k      the linear index of the element
+ */
+template <class Support, std::size_t N>
+KOKKOS_FUNCTION Support::discrete_element_type team_unravel_index(
+        Support const& domain,
+        std::array<DiscreteVectorElement, N> const& size,
+        DiscreteVectorElement k) noexcept
+{
+    std::array<DiscreteVectorElement, N> ids {};
+    for (std::size_t i = N; i-- > 0;) {
+        ids[i] = k % size[i];
+        k /= size[i];
+    }
+    return domain(typename Support::discrete_vector_type(ids));
+}
+
+/// Returns the product of all the extents but the last one
+template <std::size_t N>
+KOKKOS_FUNCTION DiscreteVectorElement
+team_outer_size(std::array<DiscreteVectorElement, N> const& size) noexcept
+{
+    DiscreteVectorElement outer_size = 1;
+    for (std::size_t i = 0; i + 1 < N; ++i) {
+        outer_size *= size[i];
+    }
+    return outer_size;
+}
+
+} // namespace detail
+
+/** iterates over a nD domain using the threads of a `Kokkos` team. Must be called by all the
+ * threads of the team.
+ *
+ * The last dimension is distributed over the vector lanes (`Kokkos::ThreadVectorRange`) and the
+ * other ones over the threads of the team (`Kokkos::TeamThreadRange`). A 1D domain is
+ * distributed over both levels (`Kokkos::TeamVectorRange`). There is no synchronization at the
+ * end of the loop, a `team_barrier` is needed before reading the results from other threads.
+ * @param[in] team   the handle of the team executing the loop
+ * @param[in] domain the domain over which to iterate
+ * @param[in] f      a functor taking an index as parameter
+ */
+template <class TeamMember, class Support, class Functor>
+KOKKOS_FUNCTION void team_for_each(
+        TeamMember const& team,
+        Support const& domain,
+        Functor const& f) noexcept
+{
+    static constexpr std::size_t N = Support::rank();
+    [[maybe_unused]] std::array const size = detail::array(domain.extents());
+    if constexpr (N == 0) {
+        Kokkos::single(Kokkos::PerTeam(team), [&]() {
+            f(domain(typename Support::discrete_vector_type()));
+        });
+    } else if constexpr (N == 1) {
+        Kokkos::parallel_for(
+                Kokkos::TeamVectorRange(team, size[0]),
+                [&](DiscreteVectorElement const i) {
+                    f(domain(typename Support::discrete_vector_type(i)));
+                });
+    } else {
+        Kokkos::parallel_for(
+                Kokkos::TeamThreadRange(team, detail::team_outer_size(size)),
+                [&](DiscreteVectorElement const i_outer) {
+                    Kokkos::parallel_for(
+                            Kokkos::ThreadVectorRange(team, size[N - 1]),
+                            [&](DiscreteVectorElement const i_inner) {
+                                f(detail::team_unravel_index(
+                                        domain,
+                                        size,
+                                        i_outer * size[N - 1] + i_inner));
+                            });
+                });
+    }
+}
+
+} // namespace ddc
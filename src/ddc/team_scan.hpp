@@ -0,0 +1,46 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include <Kokkos_Core.hpp>
+
+#include "discrete_vector.hpp"
+#include "team_for_each.hpp"
+
+namespace ddc {
+
+/** A prefix sum over a nD domain, enumerated in the row-major order, using the threads of a
+ * `Kokkos` team. Must be called by all the threads of the team.
+ *
+ * The elements are distributed over the threads of the team (`Kokkos::TeamThreadRange`), the
+ * vector level is left free. As for `Kokkos::parallel_scan`, the functor is called with the
+ * partial sum of the previous elements, it must add the contribution of the current element and
+ * may write the partial sums when `is_final` is true.
+ * @param[in] team   the handle of the team executing the scan
+ * @param[in] domain the domain over which to iterate
+ * @param[in] f      a functor with the signature `void(discrete_element_type, T& partial_sum,
+ *                   bool is_final)`
+ * @param[out] total the sum over the whole domain, returned to all the threads of the team
+ */
+template <class TeamMember, class Support, class Functor, class T>
+KOKKOS_FUNCTION void team_scan(
+        TeamMember const& team,
+        Support const& domain,
+        Functor const& f,
+        T& total) noexcept
+{
+    std::array const size = detail::array(domain.extents());
+    Kokkos::parallel_scan(
+            Kokkos::TeamThreadRange(team, static_cast<DiscreteVectorElement>(domain.size())),
+            [&](DiscreteVectorElement const k, T& partial_sum, bool const is_final) {
+                f(detail::team_unravel_index(domain, size, k), partial_sum, is_final);
+            },
+            total);
+}
+
+} // namespace ddc
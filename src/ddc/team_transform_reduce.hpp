@@ -0,0 +1,85 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include <Kokkos_Core.hpp>
+
+#include "detail/macros.hpp"
+
+#include "discrete_vector.hpp"
+#include "parallel_transform_reduce.hpp"
+#include "team_for_each.hpp"
+
+namespace ddc {
+
+/** A reduction over a nD domain using the threads of a `Kokkos` team. Must be called by all the
+ * threads of the team, the result is returned to all of them.
+ *
+ * The work is distributed as in `team_for_each`. The reduction operation must be one of the
+ * reducers of `ddc::reducer`. The result is `reduce(neutral, r)` where `r` is the reduction of
+ * the transformed elements, so that a `neutral` other than the identity of the reducer is
+ * combined exactly once.
+ * @param[in] team the handle of the team executing the reduction
+ * @param[in] domain the range over which to apply the algorithm
+ * @param[in] neutral the neutral element of the reduction operation
+ * @param[in] reduce a binary FunctionObject that will be applied in unspecified order to the
+ *            results of transform, the results of other reduce and neutral.
+ * @param[in] transform a unary FunctionObject that will be applied to each element of the input
+ *            range. The return type must be acceptable as input to reduce
+ */
+template <class TeamMember, class Support, class T, class BinaryReductionOp, class UnaryTransformOp>
+KOKKOS_FUNCTION T team_transform_reduce(
+        TeamMember const& team,
+        Support const& domain,
+        T neutral,
+        BinaryReductionOp const& reduce,
+        UnaryTransformOp const& transform) noexcept
+{
+    using kokkos_reducer_type = detail::ddc_to_kokkos_reducer_t<BinaryReductionOp>;
+    static constexpr std::size_t N = Support::rank();
+    [[maybe_unused]] std::array const size = detail::array(domain.extents());
+    DDC_IF_NVCC_THEN_PUSH_AND_SUPPRESS(implicit_return_from_non_void_function)
+    if constexpr (N == 0) {
+        return reduce(neutral, transform(domain(typename Support::discrete_vector_type())));
+    } else if constexpr (N == 1) {
+        T result = neutral;
+        Kokkos::parallel_reduce(
+                Kokkos::TeamVectorRange(team, size[0]),
+                [&](DiscreteVectorElement const i, T& a) {
+                    a = reduce(a, transform(domain(typename Support::discrete_vector_type(i))));
+                },
+                kokkos_reducer_type(result));
+        // the Kokkos reducer starts from its own identity
+        return reduce(neutral, result);
+    } else {
+        T result = neutral;
+        Kokkos::parallel_reduce(
+                Kokkos::TeamThreadRange(team, detail::team_outer_size(size)),
+                [&](DiscreteVectorElement const i_outer, T& a) {
+                    T inner_result = neutral;
+                    Kokkos::parallel_reduce(
+                            Kokkos::ThreadVectorRange(team, size[N - 1]),
+                            [&](DiscreteVectorElement const i_inner, T& b) {
+                                b = reduce(
+                                        b,
+                                        transform(detail::team_unravel_index(
+                                                domain,
+                                                size,
+                                                i_outer * size[N - 1] + i_inner)));
+                            },
+                            kokkos_reducer_type(inner_result));
+                    a = reduce(a, inner_result);
+                },
+                kokkos_reducer_type(result));
+        // the Kokkos reducer starts from its own identity
+        return reduce(neutral, result);
+    }
+    DDC_IF_NVCC_THEN_POP
+}
+
+} // namespace ddc
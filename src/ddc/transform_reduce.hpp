@@ -4,15 +4,19 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <utility>
+#include <vector>
 
-#include <Kokkos_Macros.hpp>
+#include <Kokkos_Core.hpp>
 
+#include "detail/host_blocks.hpp"
 #include "detail/macros.hpp"
 
 #include "discrete_vector.hpp"
+#include "for_each.hpp"
 
 namespace ddc {
 
@@ -137,6 +141,69 @@ T host_transform_reduce(
             std::forward<UnaryTransformOp>(transform));
 }
 
+/** A reduction over a nD domain in parallel using a host `Kokkos` execution space.
+ *
+ * The domain is split in blocks of a fixed size that are reduced in serial, the partial results
+ * are then combined following a pairwise tree. As the shape of the tree only depends on the size
+ * of the domain, the result does not depend on the number of threads, even for non-associative
+ * operations like floating-point sums.
+ * @param[in] execution_space a Kokkos execution space accessing the host memory
+ * @param[in] domain the range over which to apply the algorithm
+ * @param[in] neutral the neutral element of the reduction operation
+ * @param[in] reduce a binary FunctionObject that will be applied in a deterministic order to the
+ *            results of transform, the results of other reduce and neutral.
+ * @param[in] transform a unary FunctionObject that will be applied to each element of the input
+ *            range. The return type must be acceptable as input to reduce
+ */
+template <class ExecSpace, class Support, class T, class BinaryReductionOp, class UnaryTransformOp>
+T host_transform_reduce(
+        ExecSpace const& execution_space,
+        Support const& domain,
+        T neutral,
+        BinaryReductionOp&& reduce,
+        UnaryTransformOp&& transform) noexcept
+    requires(Kokkos::is_execution_space_v<ExecSpace>)
+{
+    static_assert(
+            Kokkos::SpaceAccessibility<ExecSpace, Kokkos::HostSpace>::accessible,
+            "The execution space must be able to access the host memory");
+    std::array const size = detail::array(domain.extents());
+    std::size_t const nelems = domain.size();
+    std::size_t const block_size = detail::host_block_size;
+    std::size_t const nblocks = (nelems + block_size - 1) / block_size;
+    if (nblocks == 0) {
+        return neutral;
+    }
+
+    std::vector<T> partial_results(nblocks, neutral);
+    Kokkos::parallel_for(
+            "ddc_host_transform_reduce",
+            Kokkos::RangePolicy<ExecSpace, Kokkos::IndexType<std::size_t>>(
+                    execution_space,
+                    0,
+                    nblocks),
+            [&](std::size_t const iblock) {
+                T partial_result = neutral;
+                detail::host_for_each_block(
+                        domain,
+                        size,
+                        iblock * block_size,
+                        std::min(nelems, (iblock + 1) * block_size),
+                        [&](typename Support::discrete_element_type const ielem) {
+                            partial_result = reduce(partial_result, transform(ielem));
+                        });
+                partial_results[iblock] = partial_result;
+            });
+    execution_space.fence("ddc_host_transform_reduce");
+
+    for (std::size_t stride = 1; stride < nblocks; stride *= 2) {
+        for (std::size_t i = 0; i + stride < nblocks; i += 2 * stride) {
+            partial_results[i] = reduce(partial_results[i], partial_results[i + stride]);
+        }
+    }
+    return partial_results[0];
+}
+
 /** A reduction over a nD domain in serial. Can be called from a device kernel.
  * @param[in] domain the range over which to apply the algorithm
  * @param[in] neutral the neutral element of the reduction operation
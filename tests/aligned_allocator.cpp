@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: MIT
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -11,6 +12,8 @@
 
 #include <gtest/gtest.h>
 
+#include <Kokkos_Core.hpp>
+
 using T = double;
 using A = ddc::AlignedAllocator<T, 64>;
 using U = char;
@@ -101,3 +104,13 @@ TEST(AlignedAllocatorTest, AllocationType)
                  decltype(std::declval<A>().allocate(1)),
                  std::allocator_traits<A>::pointer>));
 }
+
+TEST(AlignedAllocatorTest, Chunk)
+{
+    EXPECT_TRUE((std::is_same_v<A::memory_space, Kokkos::HostSpace>));
+    ddc::DiscreteDomain<> const dom;
+    ddc::Chunk<T, ddc::DiscreteDomain<>, A> chunk("chunk", dom);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(chunk.data_handle()) % 64, 0);
+    chunk() = 1.;
+    EXPECT_EQ(chunk(), 1.);
+}
@@ -730,6 +730,46 @@ TEST(Chunk2DTest, Mirror)
     }
 }
 
+TEST(Chunk2DTest, ResetDomainReusesAllocation)
+{
+    ChunkXY<double> chunk("reset_domain", dom_x_y);
+    double const* const data = chunk.data_handle();
+    EXPECT_EQ(chunk.capacity(), dom_x_y.size());
+
+    DDomXY const shifted_dom(lbound_x_y + DVectXY(1, 2), nelems_x_y - DVectXY(1, 0));
+    chunk.reset_domain(shifted_dom);
+    EXPECT_EQ(chunk.domain(), shifted_dom);
+    EXPECT_EQ(chunk.data_handle(), data);
+    EXPECT_EQ(chunk.capacity(), dom_x_y.size());
+    EXPECT_EQ(std::string_view(chunk.label()), "reset_domain");
+    ddc::parallel_fill(chunk, 1.);
+    for (DElemXY const ixy : shifted_dom) {
+        EXPECT_EQ(chunk(ixy), 1.);
+    }
+}
+
+TEST(Chunk2DTest, ResetDomainGrowth)
+{
+    ChunkXY<double> chunk(dom_x_y);
+
+    DDomXY const larger_dom(lbound_x_y, nelems_x_y + DVectXY(0, 1));
+    chunk.reset_domain(larger_dom);
+    EXPECT_EQ(chunk.domain(), larger_dom);
+    EXPECT_EQ(chunk.capacity(), larger_dom.size());
+
+    DDomXY const largest_dom(lbound_x_y, nelems_x_y + DVectXY(0, 2));
+    chunk.reset_domain(largest_dom, ddc::GeometricGrowth {2.});
+    EXPECT_EQ(chunk.domain(), largest_dom);
+    EXPECT_EQ(chunk.capacity(), 2 * larger_dom.size());
+    ddc::parallel_fill(chunk, 2.);
+    for (DElemXY const ixy : largest_dom) {
+        EXPECT_EQ(chunk(ixy), 2.);
+    }
+
+    ChunkXY<double> const moved_chunk(std::move(chunk));
+    EXPECT_EQ(moved_chunk.capacity(), 2 * larger_dom.size());
+}
+
 TEST(ChunkStridedDiscreteDomain, Constructor)
 {
     ddc::StridedDiscreteDomain<DDimX, DDimY> const dom(lbound_x_y, nelems_x_y, DVectXY(10, 10));
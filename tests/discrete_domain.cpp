@@ -327,3 +327,41 @@ TEST(DiscreteDomainTest, Select)
     EXPECT_EQ(ddc::select<DDimX>(dom_x_y), dom_x);
     EXPECT_EQ(ddc::select<DDimY>(dom_x_y), dom_y);
 }
+
+TEST(DiscreteDomainTest, IndexTypes)
+{
+#if DDC_BUILD_32BIT_INDICES()
+    EXPECT_EQ(sizeof(ddc::DiscreteElementType), 4U);
+    EXPECT_EQ(sizeof(ddc::DiscreteVectorElement), 4U);
+#else
+    EXPECT_EQ(sizeof(ddc::DiscreteElementType), 8U);
+    EXPECT_EQ(sizeof(ddc::DiscreteVectorElement), 8U);
+#endif
+}
+
+TEST(DiscreteDomainTest, RepresentableDomain)
+{
+    EXPECT_TRUE(ddc::detail::is_representable_domain(lbound_x_y, nelems_x_y));
+    EXPECT_FALSE(ddc::detail::is_representable_domain(lbound_x, DVectX(-1)));
+    DElemX const last_x(ddc::detail::max_discrete_element_uid);
+    EXPECT_TRUE(ddc::detail::is_representable_domain(last_x, DVectX(0)));
+    EXPECT_FALSE(ddc::detail::is_representable_domain(last_x, DVectX(2)));
+    DVectXY const too_many(ddc::detail::max_discrete_vector_element, 2);
+    EXPECT_FALSE(ddc::detail::is_representable_domain(lbound_x_y, too_many));
+}
+
+TEST(DiscreteDomainTest, UnrepresentableMergedDomain)
+{
+#if !defined(NDEBUG) // The assertion is only checked if NDEBUG isn't defined
+    // each domain is representable but not the total number of elements of their product
+    DDomX const dom_x(DElemX(0), DVectX(ddc::detail::max_discrete_vector_element));
+    DDomY const dom_y(DElemY(0), DVectY(2));
+    char const* const death_msg = R"rgx(.ssert.*is_representable_domain)rgx";
+    EXPECT_DEATH((DDomXY(dom_x, dom_y)), death_msg);
+    DElemXY const front_x_y(dom_x.front(), dom_y.front());
+    DVectXY const extents_x_y(dom_x.extents(), dom_y.extents());
+    EXPECT_DEATH((DDomXY(front_x_y, extents_x_y)), death_msg);
+#else
+    GTEST_SKIP();
+#endif
+}
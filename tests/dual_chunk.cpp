@@ -0,0 +1,114 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdexcept>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+inline namespace anonymous_namespace_workaround_dual_chunk_cpp {
+
+struct DDimX
+{
+};
+using DElemX = ddc::DiscreteElement<DDimX>;
+using DVectX = ddc::DiscreteVector<DDimX>;
+using DDomX = ddc::DiscreteDomain<DDimX>;
+
+struct DDimY
+{
+};
+using DElemY = ddc::DiscreteElement<DDimY>;
+using DVectY = ddc::DiscreteVector<DDimY>;
+using DDomY = ddc::DiscreteDomain<DDimY>;
+
+using DElemXY = ddc::DiscreteElement<DDimX, DDimY>;
+using DVectXY = ddc::DiscreteVector<DDimX, DDimY>;
+using DDomXY = ddc::DiscreteDomain<DDimX, DDimY>;
+
+DElemX constexpr lbound_x = ddc::init_trivial_half_bounded_space<DDimX>();
+DVectX constexpr nelems_x(10);
+
+DElemY constexpr lbound_y = ddc::init_trivial_half_bounded_space<DDimY>();
+DVectY constexpr nelems_y(12);
+
+DElemXY constexpr lbound_x_y(lbound_x, lbound_y);
+DVectXY constexpr nelems_x_y(nelems_x, nelems_y);
+
+using DualChunkXY = ddc::DualChunk<double, DDomXY>;
+
+} // namespace anonymous_namespace_workaround_dual_chunk_cpp
+
+TEST(DualChunk, SyncOnlyWhenNeeded)
+{
+    DDomXY const dom(lbound_x_y, nelems_x_y);
+    DualChunkXY chunk("dual_chunk", dom);
+    EXPECT_EQ(chunk.domain(), dom);
+    EXPECT_FALSE(chunk.need_sync<Kokkos::HostSpace>());
+    EXPECT_FALSE(chunk.need_sync<Kokkos::DefaultExecutionSpace>());
+
+    ddc::parallel_fill(chunk.span_view<Kokkos::DefaultExecutionSpace>(), 1.);
+    EXPECT_EQ(chunk.need_sync<Kokkos::HostSpace>(), !DualChunkXY::is_shared);
+    EXPECT_FALSE(chunk.need_sync<Kokkos::DefaultExecutionSpace>());
+    EXPECT_EQ(chunk.modified_domain(), dom);
+
+    chunk.sync<Kokkos::HostSpace>();
+    EXPECT_FALSE(chunk.need_sync<Kokkos::HostSpace>());
+    ddc::ChunkSpan const host_view = chunk.span_cview<Kokkos::HostSpace>();
+    for (DElemXY const ixy : dom) {
+        EXPECT_EQ(host_view(ixy), 1.);
+    }
+}
+
+TEST(DualChunk, IncrementalSync)
+{
+    DDomXY const dom(lbound_x_y, nelems_x_y);
+    DDomXY const subdom(lbound_x_y + DVectXY(2, 3), DVectXY(4, 5));
+    DualChunkXY chunk("dual_chunk", dom);
+    ddc::parallel_fill(chunk.span_view<Kokkos::DefaultExecutionSpace>(), 1.);
+    chunk.sync<Kokkos::HostSpace>();
+
+    ddc::parallel_fill(chunk.span_view<Kokkos::HostSpace>(subdom), 2.);
+    EXPECT_EQ(chunk.need_sync<Kokkos::DefaultExecutionSpace>(), !DualChunkXY::is_shared);
+    if (!DualChunkXY::is_shared) {
+        EXPECT_EQ(chunk.modified_domain(), subdom);
+    }
+
+    chunk.sync<Kokkos::DefaultExecutionSpace>();
+    EXPECT_FALSE(chunk.need_sync<Kokkos::DefaultExecutionSpace>());
+    ddc::Chunk const device_copy
+            = ddc::create_mirror_and_copy(chunk.span_cview<Kokkos::DefaultExecutionSpace>());
+    for (DElemXY const ixy : dom) {
+        EXPECT_EQ(device_copy(ixy), subdom.contains(ixy) ? 2. : 1.);
+    }
+}
+
+TEST(DualChunk, ModifiedRegionsAreMerged)
+{
+    if (DualChunkXY::is_shared) {
+        GTEST_SKIP() << "The host and device sides share the same allocation";
+    }
+    DDomXY const dom(lbound_x_y, nelems_x_y);
+    DualChunkXY chunk("dual_chunk", dom);
+    chunk.clear_sync_state();
+    chunk.modify<Kokkos::HostSpace>(DDomXY(lbound_x_y + DVectXY(1, 2), DVectXY(2, 2)));
+    chunk.modify<Kokkos::HostSpace>(DDomXY(lbound_x_y + DVectXY(4, 1), DVectXY(1, 2)));
+    EXPECT_EQ(chunk.modified_domain(), DDomXY(lbound_x_y + DVectXY(1, 1), DVectXY(4, 3)));
+}
+
+TEST(DualChunk, ConcurrentModificationsThrow)
+{
+    if (DualChunkXY::is_shared) {
+        GTEST_SKIP() << "The host and device sides share the same allocation";
+    }
+    DDomXY const dom(lbound_x_y, nelems_x_y);
+    DualChunkXY chunk("dual_chunk", dom);
+    chunk.modify<Kokkos::HostSpace>();
+    EXPECT_THROW(chunk.modify<Kokkos::DefaultExecutionSpace>(), std::runtime_error);
+    chunk.sync<Kokkos::DefaultExecutionSpace>();
+    EXPECT_NO_THROW(chunk.modify<Kokkos::DefaultExecutionSpace>());
+}
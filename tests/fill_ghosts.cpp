@@ -0,0 +1,107 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+inline namespace anonymous_namespace_workaround_fill_ghosts_cpp {
+
+struct DDimX
+{
+};
+using DElemX = ddc::DiscreteElement<DDimX>;
+using DVectX = ddc::DiscreteVector<DDimX>;
+
+struct DDimY
+{
+};
+using DElemY = ddc::DiscreteElement<DDimY>;
+using DVectY = ddc::DiscreteVector<DDimY>;
+
+using DElemXY = ddc::DiscreteElement<DDimX, DDimY>;
+using DVectXY = ddc::DiscreteVector<DDimX, DDimY>;
+using DDomXY = ddc::DiscreteDomain<DDimX, DDimY>;
+
+DElemX constexpr lbound_x = ddc::init_trivial_half_bounded_space<DDimX>();
+DVectX constexpr nelems_x(10);
+DVectX constexpr nghosts_x(2);
+
+DElemY constexpr lbound_y = ddc::init_trivial_half_bounded_space<DDimY>();
+DVectY constexpr nelems_y(12);
+DVectY constexpr nghosts_y(1);
+
+DDomXY const ghosted_dom(
+        DElemXY(lbound_x, lbound_y),
+        DVectXY(nelems_x + 2 * nghosts_x, nelems_y + 2 * nghosts_y));
+DDomXY const inner_dom
+        = ghosted_dom.remove(DVectXY(nghosts_x, nghosts_y), DVectXY(nghosts_x, nghosts_y));
+
+// A function linear in each direction
+KOKKOS_FUNCTION double linear(DElemXY const ixy)
+{
+    DVectXY const pos = ixy - DElemXY(lbound_x + nghosts_x, lbound_y + nghosts_y);
+    return 10. * ddc::get<DDimX>(pos) + ddc::get<DDimY>(pos);
+}
+
+ddc::Chunk<double, DDomXY> fill_and_copy_to_host(auto const&... policies)
+{
+    ddc::Chunk chunk(ghosted_dom, ddc::DeviceAllocator<double>());
+    ddc::parallel_fill(chunk, -1.);
+    ddc::ChunkSpan const chunk_span = chunk.span_view();
+    ddc::parallel_for_each(
+            inner_dom,
+            KOKKOS_LAMBDA(DElemXY const ixy) { chunk_span(ixy) = linear(ixy); });
+    ddc::fill_ghosts(Kokkos::DefaultExecutionSpace(), chunk, ghosted_dom, inner_dom, policies...);
+    return ddc::create_mirror_and_copy(chunk.span_cview());
+}
+
+} // namespace anonymous_namespace_workaround_fill_ghosts_cpp
+
+TEST(FillGhosts, PeriodicMirror)
+{
+    ddc::Chunk const host = fill_and_copy_to_host(ddc::PeriodicGhosts(), ddc::MirrorGhosts());
+    for (DElemXY const ixy : ghosted_dom) {
+        DElemX ix(ixy);
+        DElemY iy(ixy);
+        if (ix < DElemX(inner_dom.front())) {
+            ix += nelems_x;
+        } else if (ix > DElemX(inner_dom.back())) {
+            ix -= nelems_x;
+        }
+        DElemY const front_y(inner_dom.front());
+        DElemY const back_y(inner_dom.back());
+        if (iy < front_y) {
+            iy = front_y + (front_y - iy);
+        } else if (iy > back_y) {
+            iy = back_y - (iy - back_y);
+        }
+        EXPECT_DOUBLE_EQ(host(ixy), linear(DElemXY(ix, iy)));
+    }
+}
+
+TEST(FillGhosts, Extrapolated)
+{
+    ddc::Chunk const host
+            = fill_and_copy_to_host(ddc::ExtrapolatedGhosts(), ddc::ExtrapolatedGhosts());
+    for (DElemXY const ixy : ghosted_dom) {
+        EXPECT_DOUBLE_EQ(host(ixy), linear(ixy));
+    }
+}
+
+TEST(FillGhosts, Constant)
+{
+    ddc::Chunk const host
+            = fill_and_copy_to_host(ddc::ConstantGhosts(3.), ddc::ExtrapolatedGhosts());
+    for (DElemXY const ixy : ghosted_dom) {
+        DElemX const ix(ixy);
+        if (ix < DElemX(inner_dom.front()) || ix > DElemX(inner_dom.back())) {
+            EXPECT_DOUBLE_EQ(host(ixy), 3.);
+        } else {
+            EXPECT_DOUBLE_EQ(host(ixy), linear(ixy));
+        }
+    }
+}
@@ -0,0 +1,89 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+inline namespace anonymous_namespace_workaround_first_touch_allocator_cpp {
+
+using T = double;
+using A = ddc::FirstTouchAllocator<T>;
+using U = char;
+using B = std::allocator_traits<A>::rebind_alloc<U>;
+
+struct DDimX
+{
+};
+using DElemX = ddc::DiscreteElement<DDimX>;
+using DVectX = ddc::DiscreteVector<DDimX>;
+using DDomX = ddc::DiscreteDomain<DDimX>;
+
+struct DDimY
+{
+};
+using DElemY = ddc::DiscreteElement<DDimY>;
+using DVectY = ddc::DiscreteVector<DDimY>;
+using DDomY = ddc::DiscreteDomain<DDimY>;
+
+using DElemXY = ddc::DiscreteElement<DDimX, DDimY>;
+using DVectXY = ddc::DiscreteVector<DDimX, DDimY>;
+using DDomXY = ddc::DiscreteDomain<DDimX, DDimY>;
+
+DElemX constexpr lbound_x = ddc::init_trivial_half_bounded_space<DDimX>();
+DVectX constexpr nelems_x(10);
+
+DElemY constexpr lbound_y = ddc::init_trivial_half_bounded_space<DDimY>();
+DVectY constexpr nelems_y(12);
+
+DElemXY constexpr lbound_x_y(lbound_x, lbound_y);
+DVectXY constexpr nelems_x_y(nelems_x, nelems_y);
+
+} // namespace anonymous_namespace_workaround_first_touch_allocator_cpp
+
+TEST(FirstTouchAllocatorTest, Traits)
+{
+    using traits = std::allocator_traits<A>;
+    EXPECT_TRUE((std::is_same_v<traits::allocator_type, A>));
+    EXPECT_TRUE((std::is_same_v<traits::value_type, T>));
+    EXPECT_TRUE((std::is_same_v<traits::pointer, T*>));
+    EXPECT_TRUE((std::is_same_v<traits::rebind_alloc<U>, ddc::FirstTouchAllocator<U>>));
+    EXPECT_TRUE((std::is_same_v<traits::is_always_equal, std::true_type>));
+    EXPECT_TRUE((std::is_same_v<A::memory_space, Kokkos::HostSpace>));
+    EXPECT_TRUE((std::is_constructible_v<A, B const&>));
+}
+
+TEST(FirstTouchAllocatorTest, Allocate)
+{
+    A const allocator;
+    std::size_t const n = 1000;
+    T* const ptr = allocator.allocate("first_touch", n);
+    for (std::size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(ptr[i], T());
+    }
+    allocator.deallocate(ptr, n);
+}
+
+TEST(FirstTouchAllocatorTest, Chunk)
+{
+    DDomXY const dom(lbound_x_y, nelems_x_y);
+    ddc::Chunk chunk("chunk", dom, A());
+    EXPECT_TRUE((std::is_same_v<decltype(chunk)::memory_space, Kokkos::HostSpace>));
+    ddc::host_for_each(dom, [&](DElemXY const ixy) { EXPECT_EQ(chunk(ixy), T()); });
+    ddc::parallel_fill(Kokkos::DefaultHostExecutionSpace(), chunk, 1.);
+    EXPECT_EQ(
+            ddc::parallel_transform_reduce(
+                    Kokkos::DefaultHostExecutionSpace(),
+                    dom,
+                    0.,
+                    ddc::reducer::sum<T>(),
+                    chunk.span_cview()),
+            static_cast<T>(dom.size()));
+}
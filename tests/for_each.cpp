@@ -84,6 +84,40 @@ TEST(ForEachSerialHost, TwoDimensions)
     EXPECT_EQ(std::count(storage.begin(), storage.end(), 1), dom.size());
 }
 
+TEST(ForEachParallelHost, Empty)
+{
+    DDomX const dom(lbound_x, DVectX(0));
+    std::vector<int> storage(dom.size(), 0);
+    ddc::ChunkSpan<int, DDomX> const view(storage.data(), dom);
+    ddc::host_for_each(Kokkos::DefaultHostExecutionSpace(), dom, [=](DElemX const ix) {
+        view(ix) += 1;
+    });
+    EXPECT_EQ(std::count(storage.begin(), storage.end(), 1), dom.size());
+}
+
+TEST(ForEachParallelHost, ZeroDimension)
+{
+    DDom0D const dom;
+    int storage = 0;
+    ddc::ChunkSpan<int, DDom0D> const view(&storage, dom);
+    ddc::host_for_each(Kokkos::DefaultHostExecutionSpace(), dom, [=](DElem0D const ii) {
+        view(ii) += 1;
+    });
+    EXPECT_EQ(storage, 1) << storage << "\n";
+}
+
+TEST(ForEachParallelHost, TwoDimensions)
+{
+    // Large enough to be split in several blocks
+    DDomXY const dom(lbound_x_y, DVectXY(1000, 97));
+    std::vector<int> storage(dom.size(), 0);
+    ddc::ChunkSpan<int, DDomXY> const view(storage.data(), dom);
+    ddc::host_for_each(Kokkos::DefaultHostExecutionSpace(), dom, [=](DElemXY const ixy) {
+        view(ixy) += 1;
+    });
+    EXPECT_EQ(std::count(storage.begin(), storage.end(), 1), dom.size());
+}
+
 void TestDeviceForEachSerialDevice1D(
         ddc::ChunkSpan<
                 int,
@@ -0,0 +1,79 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+inline namespace anonymous_namespace_workaround_huge_page_allocator_cpp {
+
+using T = double;
+using A = ddc::HugePageAllocator<T>;
+using U = char;
+using B = std::allocator_traits<A>::rebind_alloc<U>;
+
+struct DDimX
+{
+};
+using DVectX = ddc::DiscreteVector<DDimX>;
+using DDomX = ddc::DiscreteDomain<DDimX>;
+
+} // namespace anonymous_namespace_workaround_huge_page_allocator_cpp
+
+TEST(HugePageAllocatorTest, Traits)
+{
+    using traits = std::allocator_traits<A>;
+    EXPECT_TRUE((std::is_same_v<traits::allocator_type, A>));
+    EXPECT_TRUE((std::is_same_v<traits::value_type, T>));
+    EXPECT_TRUE((std::is_same_v<traits::pointer, T*>));
+    EXPECT_TRUE((std::is_same_v<traits::rebind_alloc<U>, ddc::HugePageAllocator<U, 64>>));
+    EXPECT_TRUE((std::is_same_v<traits::is_always_equal, std::true_type>));
+    EXPECT_TRUE((std::is_same_v<A::memory_space, Kokkos::HostSpace>));
+    EXPECT_TRUE((std::is_constructible_v<A, B const&>));
+}
+
+TEST(HugePageAllocatorTest, SmallAllocation)
+{
+    A const allocator;
+    std::size_t const n = 10;
+    T* const ptr = allocator.allocate("small", n);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % 64, 0);
+    allocator.deallocate("small", ptr, n);
+}
+
+TEST(HugePageAllocatorTest, LargeAllocation)
+{
+    A const allocator;
+    std::size_t const n = 3 * A::huge_page_size / sizeof(T) + 1;
+    T* const ptr = allocator.allocate(n);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % A::huge_page_size, 0);
+    ptr[0] = 1.;
+    ptr[n - 1] = 2.;
+    EXPECT_EQ(ptr[0] + ptr[n - 1], 3.);
+    allocator.deallocate(ptr, n);
+}
+
+TEST(HugePageAllocatorTest, Chunk)
+{
+    DDomX const dom = ddc::init_trivial_bounded_space(
+            DVectX(static_cast<std::ptrdiff_t>(A::huge_page_size / sizeof(T))));
+    ddc::Chunk chunk("chunk", dom, A());
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(chunk.data_handle()) % A::huge_page_size, 0);
+    ddc::parallel_fill(Kokkos::DefaultHostExecutionSpace(), chunk, 1.);
+    EXPECT_EQ(
+            ddc::parallel_transform_reduce(
+                    Kokkos::DefaultHostExecutionSpace(),
+                    dom,
+                    0.,
+                    ddc::reducer::sum<T>(),
+                    chunk.span_cview()),
+            static_cast<T>(dom.size()));
+}
@@ -0,0 +1,100 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <type_traits>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+inline namespace anonymous_namespace_workaround_local_chunk_cpp {
+
+struct DDimX
+{
+};
+using DElemX = ddc::DiscreteElement<DDimX>;
+using DVectX = ddc::DiscreteVector<DDimX>;
+using DDomX = ddc::DiscreteDomain<DDimX>;
+
+struct DDimY
+{
+};
+using DElemY = ddc::DiscreteElement<DDimY>;
+using DVectY = ddc::DiscreteVector<DDimY>;
+using DDomY = ddc::DiscreteDomain<DDimY>;
+
+using DElemXY = ddc::DiscreteElement<DDimX, DDimY>;
+using DVectXY = ddc::DiscreteVector<DDimX, DDimY>;
+using DDomXY = ddc::DiscreteDomain<DDimX, DDimY>;
+
+DElemX constexpr lbound_x = ddc::init_trivial_half_bounded_space<DDimX>();
+DVectX constexpr nelems_x(10);
+
+DElemY constexpr lbound_y = ddc::init_trivial_half_bounded_space<DDimY>();
+DVectY constexpr nelems_y(12);
+
+DElemXY constexpr lbound_x_y(lbound_x, lbound_y);
+DVectXY constexpr nelems_x_y(nelems_x, nelems_y);
+
+using SDDomXY = ddc::StaticDiscreteDomain<DDomXY, 2, 3>;
+
+using LocalChunkXY = ddc::LocalChunk<int, SDDomXY>;
+
+} // namespace anonymous_namespace_workaround_local_chunk_cpp
+
+TEST(LocalChunk, StaticExtents)
+{
+    EXPECT_EQ(LocalChunkXY::rank(), 2U);
+    EXPECT_EQ(LocalChunkXY::size(), 6U);
+    EXPECT_EQ(LocalChunkXY::extents(), DVectXY(2, 3));
+    EXPECT_EQ(LocalChunkXY::extents_type::static_extent(0), 2U);
+    EXPECT_EQ(LocalChunkXY::extents_type::static_extent(1), 3U);
+    EXPECT_TRUE((std::is_same_v<LocalChunkXY::discrete_domain_type, SDDomXY>));
+    EXPECT_TRUE((std::is_trivially_copyable_v<LocalChunkXY>));
+    EXPECT_LE(sizeof(LocalChunkXY), sizeof(DElemXY) + 6 * sizeof(int));
+}
+
+TEST(LocalChunk, Access)
+{
+    LocalChunkXY chunk(lbound_x_y + DVectXY(1, 2));
+    EXPECT_EQ(chunk.domain(), DDomXY(lbound_x_y + DVectXY(1, 2), DVectXY(2, 3)));
+    EXPECT_EQ(chunk.domain(), SDDomXY(lbound_x_y + DVectXY(1, 2)));
+    ddc::host_for_each(chunk.domain(), [&](DElemXY const ixy) {
+        DVectXY const dxy = ixy - chunk.domain().front();
+        chunk(ixy) = ddc::get<DDimX>(dxy) * 10 + ddc::get<DDimY>(dxy);
+    });
+    EXPECT_EQ(chunk(DVectXY(1, 2)), 12);
+    EXPECT_EQ(chunk(DVectX(1), DVectY(0)), 10);
+    EXPECT_EQ(chunk.allocation_mdspan()(1, 1), 11);
+    EXPECT_EQ(chunk.data_handle()[5], 12);
+}
+
+TEST(LocalChunk, InKernel)
+{
+    DDomXY const dom(lbound_x_y, nelems_x_y);
+    ddc::Chunk sums_alloc(dom, ddc::DeviceAllocator<int>());
+    ddc::ChunkSpan const sums = sums_alloc.span_view();
+    ddc::parallel_for_each(
+            dom,
+            KOKKOS_LAMBDA(DElemXY const ixy) {
+                LocalChunkXY local(ixy);
+                ddc::device_for_each(local.domain(), [&](DElemXY const jxy) {
+                    local(jxy) = 1;
+                });
+                sums(ixy) = ddc::device_transform_reduce(
+                        local.domain(),
+                        0,
+                        ddc::reducer::sum<int>(),
+                        [&](DElemXY const jxy) { return local(jxy); });
+            });
+    int const total = ddc::parallel_transform_reduce(
+            dom,
+            0,
+            ddc::reducer::sum<int>(),
+            KOKKOS_LAMBDA(DElemXY const ixy) { return sums(ixy); });
+    EXPECT_EQ(static_cast<std::size_t>(total), LocalChunkXY::size() * dom.size());
+}
@@ -0,0 +1,114 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+inline namespace anonymous_namespace_workaround_memory_accounting_cpp {
+
+struct DDimX
+{
+};
+using DVectX = ddc::DiscreteVector<DDimX>;
+using DDomX = ddc::DiscreteDomain<DDimX>;
+
+} // namespace anonymous_namespace_workaround_memory_accounting_cpp
+
+TEST(MemoryAccounting, Chunk)
+{
+#if DDC_BUILD_MEMORY_ACCOUNTING()
+    std::string const space = Kokkos::HostSpace::name();
+    std::string const label = "memory_accounting_chunk";
+    DDomX const dom = ddc::init_trivial_bounded_space(DVectX(100));
+    ddc::MemoryUsage const usage_before = ddc::memory_usage<Kokkos::HostSpace>();
+    {
+        ddc::Chunk const chunk(label, dom, ddc::HostAllocator<double>());
+        ddc::MemoryUsage const usage = ddc::memory_usage(space, label);
+        EXPECT_EQ(usage.current_bytes, 100 * sizeof(double));
+        EXPECT_EQ(usage.peak_bytes, 100 * sizeof(double));
+        EXPECT_EQ(usage.nallocations, 1U);
+        EXPECT_EQ(
+                ddc::memory_usage<Kokkos::HostSpace>().current_bytes,
+                usage_before.current_bytes + 100 * sizeof(double));
+        {
+            ddc::Chunk const chunk2(label, dom, ddc::HostAllocator<double>());
+            EXPECT_EQ(ddc::memory_usage(space, label).current_bytes, 200 * sizeof(double));
+        }
+    }
+    ddc::MemoryUsage const usage = ddc::memory_usage(space, label);
+    EXPECT_EQ(usage.current_bytes, 0U);
+    EXPECT_EQ(usage.peak_bytes, 200 * sizeof(double));
+    EXPECT_EQ(usage.nallocations, 2U);
+    EXPECT_EQ(ddc::memory_usage<Kokkos::HostSpace>().current_bytes, usage_before.current_bytes);
+
+    ddc::reset_memory_peaks();
+    EXPECT_EQ(ddc::memory_usage(space, label).peak_bytes, 0U);
+#else
+    GTEST_SKIP() << "DDC is built without DDC_BUILD_MEMORY_ACCOUNTING";
+#endif
+}
+
+TEST(MemoryAccounting, AlignedAllocator)
+{
+#if DDC_BUILD_MEMORY_ACCOUNTING()
+    std::string const space = Kokkos::HostSpace::name();
+    std::string const label = "memory_accounting_aligned";
+    DDomX const dom = ddc::init_trivial_bounded_space(DVectX(100));
+    {
+        ddc::Chunk const chunk(label, dom, ddc::AlignedAllocator<double, 64>());
+        EXPECT_EQ(ddc::memory_usage(space, label).current_bytes, 100 * sizeof(double));
+    }
+    ddc::MemoryUsage const usage = ddc::memory_usage(space, label);
+    EXPECT_EQ(usage.current_bytes, 0U);
+    EXPECT_EQ(usage.nallocations, 1U);
+#else
+    GTEST_SKIP() << "DDC is built without DDC_BUILD_MEMORY_ACCOUNTING";
+#endif
+}
+
+TEST(MemoryAccounting, UnknownDeallocation)
+{
+#if DDC_BUILD_MEMORY_ACCOUNTING()
+    ddc::MemoryUsage const usage_before = ddc::memory_usage<Kokkos::HostSpace>();
+    double const value = 0.;
+    ddc::detail::record_deallocation(&value);
+    EXPECT_EQ(ddc::memory_usage<Kokkos::HostSpace>().current_bytes, usage_before.current_bytes);
+#else
+    GTEST_SKIP() << "DDC is built without DDC_BUILD_MEMORY_ACCOUNTING";
+#endif
+}
+
+TEST(MemoryAccounting, Report)
+{
+#if DDC_BUILD_MEMORY_ACCOUNTING()
+    std::string const label = "memory_accounting_report";
+    DDomX const dom = ddc::init_trivial_bounded_space(DVectX(10));
+    ddc::Chunk const chunk(label, dom, ddc::HostAllocator<int>());
+
+    std::vector<ddc::LabelledMemoryUsage> const usages = ddc::memory_usage_by_label();
+    EXPECT_TRUE(std::is_sorted(
+            usages.begin(),
+            usages.end(),
+            [](ddc::LabelledMemoryUsage const& lhs, ddc::LabelledMemoryUsage const& rhs) {
+                return lhs.usage.peak_bytes > rhs.usage.peak_bytes;
+            }));
+    EXPECT_TRUE(std::any_of(usages.begin(), usages.end(), [&](ddc::LabelledMemoryUsage const& u) {
+        return u.label == label && u.usage.current_bytes == 10 * sizeof(int);
+    }));
+
+    std::stringstream ss;
+    ddc::print_memory_report(ss);
+    EXPECT_NE(ss.str().find(label), std::string::npos);
+#else
+    GTEST_SKIP() << "DDC is built without DDC_BUILD_MEMORY_ACCOUNTING";
+#endif
+}
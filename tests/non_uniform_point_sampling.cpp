@@ -2,7 +2,9 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
 #include <list>
 #include <sstream>
 #include <stdexcept>
@@ -145,3 +147,92 @@ TEST_F(NonUniformPointSampling, Attributes)
     EXPECT_EQ(ddc::distance_at_left(point_ix), m_vector_points_x[2] - m_vector_points_x[1]);
     EXPECT_EQ(ddc::distance_at_right(point_ix), m_vector_points_x[3] - m_vector_points_x[2]);
 }
+
+TEST_F(NonUniformPointSampling, MeshMetrics)
+{
+    DDimX::Impl<DDimX, Kokkos::HostSpace> const ddim_x(
+            {ddc::Coordinate<DimX>(0.),
+             ddc::Coordinate<DimX>(1.),
+             ddc::Coordinate<DimX>(3.),
+             ddc::Coordinate<DimX>(7.)});
+    ddc::MeshMetrics<DDimX> const metrics = ddim_x.metrics();
+    ddc::DiscreteElement<DDimX> const ix = ddim_x.front() + ddc::DiscreteVector<DDimX>(1);
+    EXPECT_DOUBLE_EQ(metrics.distance_at_left(ix), 1.);
+    EXPECT_DOUBLE_EQ(metrics.distance_at_right(ix), 2.);
+    EXPECT_DOUBLE_EQ(metrics.cell_width(ix), 1.5);
+    EXPECT_DOUBLE_EQ(metrics.inv_distance_at_left(ix), 1.);
+    EXPECT_DOUBLE_EQ(metrics.inv_distance_at_right(ix), 0.5);
+    EXPECT_DOUBLE_EQ(metrics.inv_cell_width(ix), 1. / 1.5);
+    EXPECT_DOUBLE_EQ(ddim_x.distance_at_left(ix), 1.);
+    EXPECT_DOUBLE_EQ(ddim_x.distance_at_right(ix), 2.);
+    // the missing distances at the ends are replaced by the ones on the other side
+    EXPECT_DOUBLE_EQ(metrics.distance_at_left(ddim_x.front()), 1.);
+    ddc::DiscreteElement<DDimX> const back = ddim_x.front() + ddc::DiscreteVector<DDimX>(3);
+    EXPECT_DOUBLE_EQ(metrics.distance_at_right(back), 4.);
+}
+
+TEST_F(NonUniformPointSampling, Locate)
+{
+    std::vector<ddc::Coordinate<DimX>> const points {
+            ddc::Coordinate<DimX>(0.),
+            ddc::Coordinate<DimX>(0.1),
+            ddc::Coordinate<DimX>(0.15),
+            ddc::Coordinate<DimX>(0.2),
+            ddc::Coordinate<DimX>(1.),
+            ddc::Coordinate<DimX>(2.)};
+    DDimX::Impl<DDimX, Kokkos::HostSpace> const ddim_x(points);
+    ddc::DiscreteElement<DDimX> const front = ddim_x.front();
+    EXPECT_EQ(ddim_x.locate(ddc::Coordinate<DimX>(-1.)), front);
+    EXPECT_EQ(ddim_x.locate(ddc::Coordinate<DimX>(0.)), front);
+    EXPECT_EQ(ddim_x.locate(ddc::Coordinate<DimX>(2.)), front + ddc::DiscreteVector<DDimX>(4));
+    EXPECT_EQ(ddim_x.locate(ddc::Coordinate<DimX>(3.)), front + ddc::DiscreteVector<DDimX>(4));
+    for (std::size_t i = 0; i + 1 < points.size(); ++i) {
+        ddc::DiscreteElement<DDimX> const icell = front + ddc::DiscreteVector<DDimX>(i);
+        EXPECT_EQ(ddim_x.locate(points[i]), icell);
+        ddc::Coordinate<DimX> const middle((double(points[i]) + double(points[i + 1])) / 2);
+        EXPECT_EQ(ddim_x.locate(middle), icell);
+    }
+
+    ddc::init_discrete_space<DDimX>(DDimX::init<DDimX>(m_vector_points_x));
+    EXPECT_EQ(ddc::locate<DDimX>(ddc::Coordinate<DimX>(0.35)), point_ix);
+}
+
+TEST_F(NonUniformPointSampling, LocateGradedMesh)
+{
+    // most of the points lie in the first bucket
+    std::size_t const npoints = 1000;
+    std::vector<ddc::Coordinate<DimX>> points(npoints);
+    for (std::size_t i = 0; i < npoints; ++i) {
+        double const s = static_cast<double>(i) / (npoints - 1);
+        points[i] = ddc::Coordinate<DimX>(s * s * s * s);
+    }
+    DDimX::Impl<DDimX, Kokkos::HostSpace> const ddim_x(points);
+    std::size_t const nsamples = 10000;
+    for (std::size_t j = 0; j < nsamples; ++j) {
+        double const t = static_cast<double>(j) / (nsamples - 1);
+        ddc::Coordinate<DimX> const x(t * t * t * t * t);
+        // the last point at or before x, found by a binary search
+        std::size_t const ref = std::min(
+                static_cast<std::size_t>(std::upper_bound(points.begin(), points.end(), x)
+                                         - points.begin() - 1),
+                npoints - 2);
+        EXPECT_EQ(ddim_x.locate(x), ddim_x.front() + ddc::DiscreteVector<DDimX>(ref));
+    }
+}
+
+TEST_F(NonUniformPointSampling, MeshMetricsSinglePoint)
+{
+    DDimX::Impl<DDimX, Kokkos::HostSpace> const ddim_x {ddc::Coordinate<DimX>(2.)};
+    ddc::MeshMetrics<DDimX> const metrics = ddim_x.metrics();
+    // a single point has no distance to measure
+    EXPECT_EQ(metrics.distance_at_left(ddim_x.front()), 0.);
+    EXPECT_EQ(metrics.distance_at_right(ddim_x.front()), 0.);
+    EXPECT_EQ(metrics.cell_width(ddim_x.front()), 0.);
+    EXPECT_EQ(metrics.inv_distance_at_left(ddim_x.front()), 0.);
+    EXPECT_EQ(metrics.inv_distance_at_right(ddim_x.front()), 0.);
+    EXPECT_EQ(metrics.inv_cell_width(ddim_x.front()), 0.);
+#if !defined(NDEBUG) // The assertion is only checked if NDEBUG isn't defined
+    EXPECT_DEATH(ddim_x.distance_at_left(ddim_x.front()), R"rgx(.ssert.*size\(\) >= 2)rgx");
+    EXPECT_DEATH(ddim_x.distance_at_right(ddim_x.front()), R"rgx(.ssert.*size\(\) >= 2)rgx");
+#endif
+}
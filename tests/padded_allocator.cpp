@@ -0,0 +1,109 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+inline namespace anonymous_namespace_workaround_padded_allocator_cpp {
+
+using T = double;
+using A = ddc::PaddedAllocator<ddc::AlignedAllocator<T, 64>>;
+
+struct DDimX
+{
+};
+using DElemX = ddc::DiscreteElement<DDimX>;
+using DVectX = ddc::DiscreteVector<DDimX>;
+using DDomX = ddc::DiscreteDomain<DDimX>;
+
+struct DDimY
+{
+};
+using DElemY = ddc::DiscreteElement<DDimY>;
+using DVectY = ddc::DiscreteVector<DDimY>;
+using DDomY = ddc::DiscreteDomain<DDimY>;
+
+using DElemXY = ddc::DiscreteElement<DDimX, DDimY>;
+using DVectXY = ddc::DiscreteVector<DDimX, DDimY>;
+using DDomXY = ddc::DiscreteDomain<DDimX, DDimY>;
+
+DElemX constexpr lbound_x = ddc::init_trivial_half_bounded_space<DDimX>();
+DVectX constexpr nelems_x(16);
+
+DElemY constexpr lbound_y = ddc::init_trivial_half_bounded_space<DDimY>();
+DVectY constexpr nelems_y(32);
+
+DElemXY constexpr lbound_x_y(lbound_x, lbound_y);
+DVectXY constexpr nelems_x_y(nelems_x, nelems_y);
+
+} // namespace anonymous_namespace_workaround_padded_allocator_cpp
+
+TEST(PaddedAllocatorTest, Traits)
+{
+    EXPECT_TRUE((std::is_same_v<A::value_type, T>));
+    EXPECT_TRUE((std::is_same_v<A::memory_space, Kokkos::HostSpace>));
+    EXPECT_TRUE((std::is_same_v<A::layout_type, Kokkos::layout_stride>));
+    EXPECT_TRUE((std::is_same_v<
+                 std::allocator_traits<A>::rebind_alloc<float>,
+                 ddc::PaddedAllocator<ddc::AlignedAllocator<float, 64>>>));
+}
+
+TEST(PaddedAllocatorTest, Pitch)
+{
+    // 8 doubles per block of 64 bytes, the number of blocks is odd
+    EXPECT_EQ(A::pitch(1), 8);
+    EXPECT_EQ(A::pitch(8), 8);
+    EXPECT_EQ(A::pitch(9), 24);
+    EXPECT_EQ(A::pitch(24), 24);
+    EXPECT_EQ(A::pitch(32), 40);
+    EXPECT_EQ(A::pitch(1024), 1032);
+}
+
+TEST(PaddedAllocatorTest, Chunk)
+{
+    DDomXY const dom(lbound_x_y, nelems_x_y);
+    ddc::Chunk chunk("chunk", dom, A());
+    EXPECT_TRUE((std::is_same_v<
+                 decltype(chunk.span_view()),
+                 ddc::ChunkSpan<T, DDomXY, Kokkos::layout_stride, Kokkos::HostSpace>>));
+    EXPECT_EQ(chunk.stride<DDimY>(), 1);
+    EXPECT_EQ(chunk.stride<DDimX>(), A::pitch(nelems_y.value()));
+    for (DElemX const ix : DDomX(dom)) {
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(&chunk(ix, DDomY(dom).front())) % 64, 0);
+    }
+
+    ddc::ChunkSpan const chunk_span = chunk.span_view();
+    ddc::parallel_for_each(
+            Kokkos::DefaultHostExecutionSpace(),
+            dom,
+            [=](DElemXY const ixy) {
+                chunk_span(ixy) = static_cast<T>((DElemX(ixy) - lbound_x).value());
+            });
+    EXPECT_EQ(
+            ddc::parallel_transform_reduce(
+                    Kokkos::DefaultHostExecutionSpace(),
+                    dom,
+                    0.,
+                    ddc::reducer::sum<T>(),
+                    chunk.span_cview()),
+            static_cast<T>(nelems_y.value() * nelems_x.value() * (nelems_x.value() - 1) / 2));
+
+    // Slicing a row
+    ddc::ChunkSpan const row = chunk[lbound_x + 3];
+    for (DElemY const iy : DDomY(dom)) {
+        EXPECT_EQ(row(iy), 3.);
+    }
+
+    auto const view = chunk.allocation_kokkos_view();
+    EXPECT_EQ(view.stride(0), A::pitch(nelems_y.value()));
+    EXPECT_EQ(view(3, 5), 3.);
+}
@@ -0,0 +1,105 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <cstdint>
+#include <utility>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+inline namespace anonymous_namespace_workaround_parallel_checksum_cpp {
+
+using DDom0D = ddc::DiscreteDomain<>;
+
+struct DDimX
+{
+};
+using DElemX = ddc::DiscreteElement<DDimX>;
+using DVectX = ddc::DiscreteVector<DDimX>;
+using DDomX = ddc::DiscreteDomain<DDimX>;
+
+struct DDimY
+{
+};
+using DElemY = ddc::DiscreteElement<DDimY>;
+using DVectY = ddc::DiscreteVector<DDimY>;
+using DDomY = ddc::DiscreteDomain<DDimY>;
+
+using DElemXY = ddc::DiscreteElement<DDimX, DDimY>;
+using DVectXY = ddc::DiscreteVector<DDimX, DDimY>;
+using DDomXY = ddc::DiscreteDomain<DDimX, DDimY>;
+
+DElemX constexpr lbound_x = ddc::init_trivial_half_bounded_space<DDimX>();
+DVectX constexpr nelems_x(10);
+
+DElemY constexpr lbound_y = ddc::init_trivial_half_bounded_space<DDimY>();
+DVectY constexpr nelems_y(12);
+
+DElemXY constexpr lbound_x_y(lbound_x, lbound_y);
+DVectXY constexpr nelems_x_y(nelems_x, nelems_y);
+
+} // namespace anonymous_namespace_workaround_parallel_checksum_cpp
+
+TEST(ParallelChecksum, ZeroDimension)
+{
+    DDom0D const dom;
+    ddc::Chunk chunk_host(dom, ddc::HostAllocator<int>());
+    chunk_host() = 3;
+    ddc::Chunk chunk_host_copy(dom, ddc::HostAllocator<int>());
+    chunk_host_copy() = 3;
+    EXPECT_EQ(
+            ddc::parallel_checksum(Kokkos::DefaultHostExecutionSpace(), chunk_host),
+            ddc::parallel_checksum(Kokkos::DefaultHostExecutionSpace(), chunk_host_copy));
+    chunk_host_copy() = 4;
+    EXPECT_NE(
+            ddc::parallel_checksum(Kokkos::DefaultHostExecutionSpace(), chunk_host),
+            ddc::parallel_checksum(Kokkos::DefaultHostExecutionSpace(), chunk_host_copy));
+}
+
+TEST(ParallelChecksum, HostAndDevice)
+{
+    DDomXY const dom(lbound_x_y, nelems_x_y);
+    ddc::Chunk chunk_host(dom, ddc::HostAllocator<double>());
+    double value = 0.5;
+    ddc::host_for_each(dom, [&](DElemXY const ixy) {
+        chunk_host(ixy) = value;
+        value *= -1.25;
+    });
+    auto const chunk = ddc::create_mirror_view_and_copy(
+            Kokkos::DefaultExecutionSpace(),
+            chunk_host.span_view());
+
+    std::uint64_t const checksum_host
+            = ddc::parallel_checksum(Kokkos::DefaultHostExecutionSpace(), chunk_host);
+    EXPECT_EQ(ddc::parallel_checksum(chunk), checksum_host);
+    EXPECT_EQ(
+            ddc::parallel_checksum("checksum", Kokkos::DefaultExecutionSpace(), chunk),
+            checksum_host);
+}
+
+TEST(ParallelChecksum, DetectsCorruption)
+{
+    DDomXY const dom(lbound_x_y, nelems_x_y);
+    ddc::Chunk chunk_host(dom, ddc::HostAllocator<int>());
+    int count = 0;
+    ddc::host_for_each(dom, [&](DElemXY const ixy) { chunk_host(ixy) = count++; });
+    std::uint64_t const checksum
+            = ddc::parallel_checksum(Kokkos::DefaultHostExecutionSpace(), chunk_host);
+
+    DElemXY const ixy0 = dom.front();
+    DElemXY const ixy1 = dom.back();
+
+    // A single bit flip
+    chunk_host(ixy1) ^= 1 << 4;
+    EXPECT_NE(ddc::parallel_checksum(Kokkos::DefaultHostExecutionSpace(), chunk_host), checksum);
+    chunk_host(ixy1) ^= 1 << 4;
+    EXPECT_EQ(ddc::parallel_checksum(Kokkos::DefaultHostExecutionSpace(), chunk_host), checksum);
+
+    // Two values swapped
+    std::swap(chunk_host(ixy0), chunk_host(ixy1));
+    EXPECT_NE(ddc::parallel_checksum(Kokkos::DefaultHostExecutionSpace(), chunk_host), checksum);
+}
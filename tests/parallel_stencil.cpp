@@ -0,0 +1,138 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdexcept>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+inline namespace anonymous_namespace_workaround_parallel_stencil_cpp {
+
+struct DDimX
+{
+};
+using DElemX = ddc::DiscreteElement<DDimX>;
+using DVectX = ddc::DiscreteVector<DDimX>;
+
+struct DDimY
+{
+};
+using DElemY = ddc::DiscreteElement<DDimY>;
+using DVectY = ddc::DiscreteVector<DDimY>;
+
+using DElemXY = ddc::DiscreteElement<DDimX, DDimY>;
+using DVectXY = ddc::DiscreteVector<DDimX, DDimY>;
+using DDomXY = ddc::DiscreteDomain<DDimX, DDimY>;
+
+DElemX constexpr lbound_x = ddc::init_trivial_half_bounded_space<DDimX>();
+DVectX constexpr nelems_x(10);
+
+DElemY constexpr lbound_y = ddc::init_trivial_half_bounded_space<DDimY>();
+DVectY constexpr nelems_y(12);
+
+// the halos of the inputs start after the front of the half bounded spaces
+DElemXY constexpr front_x_y(lbound_x + DVectX(2), lbound_y + DVectY(2));
+DVectXY constexpr nelems_x_y(nelems_x, nelems_y);
+
+DVectXY constexpr radius(1, 1);
+
+struct Laplacian
+{
+    template <class Neighbourhood>
+    KOKKOS_FUNCTION int operator()(Neighbourhood const& u) const
+    {
+        return u(DVectX(1)) + u(DVectX(-1)) + u(DVectY(1)) + u(DVectY(-1)) - 3 * u();
+    }
+};
+
+// A chunk on `dom` extended by `n` radius filled with an arbitrary pattern
+ddc::Chunk<int, DDomXY, ddc::DeviceAllocator<int>> make_input(DDomXY const& dom, int n)
+{
+    DDomXY const in_dom(dom.front() - n * radius, dom.extents() + 2 * n * radius);
+    ddc::Chunk in(in_dom, ddc::DeviceAllocator<int>());
+    ddc::ChunkSpan const in_span = in.span_view();
+    ddc::parallel_for_each(
+            in_dom,
+            KOKKOS_LAMBDA(DElemXY const ixy) {
+                DVectXY const pos = ixy - in_dom.front();
+                in_span(ixy) = static_cast<int>(
+                        (7 * ddc::get<DDimX>(pos) + 3 * ddc::get<DDimY>(pos)) % 11);
+            });
+    return in;
+}
+
+} // namespace anonymous_namespace_workaround_parallel_stencil_cpp
+
+TEST(ParallelStencil, MatchesForEach)
+{
+    DDomXY const dom(front_x_y, nelems_x_y);
+    ddc::Chunk const in = make_input(dom, 1);
+    ddc::ChunkSpan const in_span = in.span_cview();
+    ddc::Chunk out(dom, ddc::DeviceAllocator<int>());
+    ddc::Chunk ref(dom, ddc::DeviceAllocator<int>());
+    ddc::ChunkSpan const ref_span = ref.span_view();
+    // small tiles so that the last ones are partial
+    ddc::parallel_stencil(
+            Kokkos::DefaultExecutionSpace(),
+            out,
+            in,
+            radius,
+            Laplacian(),
+            ddc::StencilOptions<DDimX, DDimY> {DVectXY(3, 5)});
+    ddc::parallel_for_each(
+            dom,
+            KOKKOS_LAMBDA(DElemXY const ixy) {
+                ref_span(ixy) = in_span(ixy + DVectX(1)) + in_span(ixy - DVectX(1))
+                                + in_span(ixy + DVectY(1)) + in_span(ixy - DVectY(1))
+                                - 3 * in_span(ixy);
+            });
+    auto const out_host = ddc::create_mirror_and_copy(out.span_cview());
+    auto const ref_host = ddc::create_mirror_and_copy(ref.span_cview());
+    for (DElemXY const ixy : dom) {
+        EXPECT_EQ(out_host(ixy), ref_host(ixy));
+    }
+}
+
+TEST(ParallelStencil, TemporalBlocking)
+{
+    DDomXY const dom(front_x_y, nelems_x_y);
+    DDomXY const dom_1(dom.front() - radius, dom.extents() + 2 * radius);
+    ddc::Chunk const in = make_input(dom, 2);
+    ddc::Chunk out(dom, ddc::DeviceAllocator<int>());
+    ddc::Chunk tmp(dom_1, ddc::DeviceAllocator<int>());
+    ddc::Chunk ref(dom, ddc::DeviceAllocator<int>());
+    ddc::parallel_stencil(
+            Kokkos::DefaultExecutionSpace(),
+            out,
+            in,
+            radius,
+            Laplacian(),
+            ddc::StencilOptions<DDimX, DDimY> {DVectXY(4, 4), 2});
+    ddc::parallel_stencil(tmp, in, radius, Laplacian());
+    ddc::parallel_stencil(ref, tmp, radius, Laplacian());
+    auto const out_host = ddc::create_mirror_and_copy(out.span_cview());
+    auto const ref_host = ddc::create_mirror_and_copy(ref.span_cview());
+    for (DElemXY const ixy : dom) {
+        EXPECT_EQ(out_host(ixy), ref_host(ixy));
+    }
+}
+
+TEST(ParallelStencil, ScratchTooSmall)
+{
+    DDomXY const dom(front_x_y, nelems_x_y);
+    ddc::Chunk const in = make_input(dom, 1);
+    ddc::Chunk out(dom, ddc::DeviceAllocator<int>());
+    EXPECT_THROW(
+            ddc::parallel_stencil(
+                    Kokkos::DefaultExecutionSpace(),
+                    out,
+                    in,
+                    radius,
+                    Laplacian(),
+                    ddc::StencilOptions<DDimX, DDimY> {DVectXY(4096, 4096)}),
+            std::runtime_error);
+}
@@ -2,6 +2,9 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <cmath>
+#include <limits>
+
 #include <ddc/ddc.hpp>
 
 #include <gtest/gtest.h>
@@ -33,6 +36,9 @@ using DElemXY = ddc::DiscreteElement<DDimX, DDimY>;
 using DVectXY = ddc::DiscreteVector<DDimX, DDimY>;
 using DDomXY = ddc::DiscreteDomain<DDimX, DDimY>;
 
+using DElemYX = ddc::DiscreteElement<DDimY, DDimX>;
+using DDomYX = ddc::DiscreteDomain<DDimY, DDimX>;
+
 DElemX constexpr lbound_x = ddc::init_trivial_half_bounded_space<DDimX>();
 DVectX constexpr nelems_x(10);
 
@@ -186,3 +192,204 @@ TEST(ParallelTransformReduceDevice, SumXY2X)
 
     EXPECT_EQ(Kokkos::Experimental::count(exec_space, storage, 12), dom_x.size());
 }
+
+TEST(ParallelTransformReduceDevice, TwoDimensionsToChunkSpan)
+{
+    Kokkos::DefaultExecutionSpace const exec_space;
+
+    DDom0D const dom_0d;
+    DDomXY const dom_x_y(lbound_x_y, nelems_x_y);
+
+    ddc::Chunk chunk_x_y(dom_x_y, ddc::DeviceAllocator<int>());
+    ddc::parallel_fill(exec_space, chunk_x_y, 1);
+
+    ddc::Chunk sum_alloc(dom_0d, ddc::DeviceAllocator<int>());
+    ddc::ChunkSpan const sum = sum_alloc.span_view();
+    ddc::parallel_transform_reduce(
+            exec_space,
+            chunk_x_y.domain(),
+            sum,
+            ddc::reducer::sum<int>(),
+            chunk_x_y.span_cview());
+
+    // The result is consumed by a kernel enqueued on the same execution space
+    ddc::ChunkSpan const chunk_x_y_view = chunk_x_y.span_view();
+    ddc::parallel_for_each(
+            exec_space,
+            chunk_x_y.domain(),
+            KOKKOS_LAMBDA(DElemXY const ixy) { chunk_x_y_view(ixy) = sum(); });
+
+    int const res = ddc::parallel_transform_reduce(
+            exec_space,
+            chunk_x_y.domain(),
+            0,
+            ddc::reducer::sum<int>(),
+            chunk_x_y.span_cview());
+    EXPECT_EQ(res, dom_x_y.size() * dom_x_y.size());
+}
+
+TEST(ParallelTransformReduceDevice, TwoDimensionsToKokkosView)
+{
+    Kokkos::DefaultExecutionSpace const exec_space;
+
+    DDomXY const dom_x_y(lbound_x_y, nelems_x_y);
+
+    ddc::Chunk chunk_x_y(dom_x_y, ddc::DeviceAllocator<int>());
+    ddc::parallel_fill(exec_space, chunk_x_y, 1);
+
+    DElemX const front_x = DElemX(dom_x_y.front());
+    Kokkos::View<int> const max(Kokkos::view_alloc("max", exec_space));
+    ddc::parallel_transform_reduce(
+            "xy2view",
+            exec_space,
+            chunk_x_y.domain(),
+            max,
+            ddc::reducer::max<int>(),
+            KOKKOS_LAMBDA(DElemXY const ixy) {
+                return static_cast<int>((DElemX(ixy) - front_x).value());
+            });
+
+    auto const max_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), max);
+    EXPECT_EQ(max_host(), nelems_x.value() - 1);
+}
+
+TEST(ParallelTransformReduceDevice, BXor)
+{
+    Kokkos::DefaultExecutionSpace const exec_space;
+
+    DDomXY const dom_x_y(lbound_x_y, nelems_x_y);
+
+    DElemX const front_x = DElemX(dom_x_y.front());
+    DElemY const front_y = DElemY(dom_x_y.front());
+    auto const transform = KOKKOS_LAMBDA(DElemXY const ixy)
+    {
+        return 31U * static_cast<unsigned>((DElemX(ixy) - front_x).value())
+               + 7U * static_cast<unsigned>((DElemY(ixy) - front_y).value()) + 1U;
+    };
+    unsigned const res = ddc::parallel_transform_reduce(
+            exec_space,
+            dom_x_y,
+            0U,
+            ddc::reducer::bxor<unsigned>(),
+            transform);
+    EXPECT_EQ(
+            res,
+            ddc::host_transform_reduce(dom_x_y, 0U, ddc::reducer::bxor<unsigned>(), transform));
+}
+
+TEST(ParallelTransformReduce, ReproducibleSum)
+{
+    DDomXY const dom(lbound_x_y, DVectXY(1000, 97));
+    DElemXY const front = dom.front();
+    // the terms are computed once so that all the sums reduce the same values, the math
+    // functions of the host and of the device may differ in the last bit
+    ddc::Chunk terms_alloc(dom, ddc::DeviceAllocator<double>());
+    ddc::ChunkSpan const terms = terms_alloc.span_view();
+    ddc::parallel_for_each(
+            dom,
+            KOKKOS_LAMBDA(DElemXY const ixy) {
+                DVectXY const dist = ixy - front;
+                double const x = static_cast<double>(ddc::get<DDimX>(dist));
+                double const y = static_cast<double>(ddc::get<DDimY>(dist));
+                terms(ixy) = Kokkos::sin(x + 0.3 * y) * Kokkos::pow(10., Kokkos::cos(x * y));
+            });
+    auto const terms_host_alloc = ddc::create_mirror_and_copy(terms.span_cview());
+    ddc::ChunkSpan const terms_host = terms_host_alloc.span_cview();
+    ddc::ChunkSpan const terms_device = terms.span_cview();
+    auto const transform_host = KOKKOS_LAMBDA(DElemXY const ixy)
+    {
+        return terms_host(ixy);
+    };
+    auto const transform_device = KOKKOS_LAMBDA(DElemXY const ixy)
+    {
+        return terms_device(ixy);
+    };
+
+    double const sum_host = ddc::parallel_transform_reduce(
+            Kokkos::DefaultHostExecutionSpace(),
+            dom,
+            0.,
+            ddc::reducer::reproducible_sum<double>(),
+            transform_host);
+    double const sum_device = ddc::parallel_transform_reduce(
+            Kokkos::DefaultExecutionSpace(),
+            dom,
+            0.,
+            ddc::reducer::reproducible_sum<double>(),
+            transform_device);
+    double const sum_serial
+            = ddc::host_transform_reduce(dom, 0., ddc::reducer::sum<double>(), transform_host);
+
+    EXPECT_EQ(sum_host, sum_device);
+    EXPECT_NEAR(sum_host, sum_serial, 1e-10 * Kokkos::abs(sum_serial));
+
+    // the same sum on fewer threads
+#if defined(KOKKOS_ENABLE_SERIAL)
+    EXPECT_EQ(
+            ddc::parallel_transform_reduce(
+                    Kokkos::Serial(),
+                    dom,
+                    0.,
+                    ddc::reducer::reproducible_sum<double>(),
+                    transform_host),
+            sum_host);
+#endif
+    auto const host_partitions
+            = Kokkos::Experimental::partition_space(Kokkos::DefaultHostExecutionSpace(), 1, 2);
+    for (Kokkos::DefaultHostExecutionSpace const& host_partition : host_partitions) {
+        EXPECT_EQ(
+                ddc::parallel_transform_reduce(
+                        host_partition,
+                        dom,
+                        0.,
+                        ddc::reducer::reproducible_sum<double>(),
+                        transform_host),
+                sum_host);
+    }
+
+    // the same sum with the terms distributed differently over the threads
+    DDomYX const dom_transposed(dom);
+    auto const transform_transposed
+            = KOKKOS_LAMBDA(DElemYX const iyx) { return terms_device(DElemXY(iyx)); };
+    EXPECT_EQ(
+            ddc::parallel_transform_reduce(
+                    Kokkos::DefaultExecutionSpace(),
+                    dom_transposed,
+                    0.,
+                    ddc::reducer::reproducible_sum<double>(),
+                    transform_transposed),
+            sum_host);
+}
+
+TEST(ParallelTransformReduce, ReproducibleSumOfLargeTerms)
+{
+    DDomX const dom(lbound_x, DVectX(1000));
+    // the terms are close to the largest finite value divided by their number
+    double const large = std::numeric_limits<double>::max() / dom.size();
+    DElemX const front = dom.front();
+    auto const transform = KOKKOS_LAMBDA(DElemX const ix)
+    {
+        double const x = static_cast<double>((ix - front).value());
+        return large * (0.5 + 0.4 * Kokkos::sin(x));
+    };
+    double const sum = ddc::parallel_transform_reduce(
+            dom,
+            0.,
+            ddc::reducer::reproducible_sum<double>(),
+            transform);
+    double const sum_serial
+            = ddc::host_transform_reduce(dom, 0., ddc::reducer::sum<double>(), transform);
+    EXPECT_TRUE(std::isfinite(sum));
+    EXPECT_NEAR(sum, sum_serial, 1e-10 * sum_serial);
+}
+
+TEST(ParallelTransformReduce, ReproducibleSumOfZeros)
+{
+    DDomXY const dom(lbound_x_y, nelems_x_y);
+    double const sum = ddc::parallel_transform_reduce(
+            dom,
+            1.,
+            ddc::reducer::reproducible_sum<double>(),
+            KOKKOS_LAMBDA(DElemXY) { return 0.; });
+    EXPECT_EQ(sum, 1.);
+}
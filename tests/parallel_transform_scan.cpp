@@ -138,3 +138,36 @@ TEST(ParallelTransformScanDevice, XYCumprodX)
         }
     }
 }
+
+TEST(ParallelTransformScanDevice, XCumxorX)
+{
+    Kokkos::DefaultExecutionSpace const exec_space;
+
+    DDomX const dom_x(lbound_x, nelems_x);
+
+    ddc::Chunk chunk_x(dom_x, ddc::DeviceAllocator<unsigned>());
+    ddc::parallel_fill(exec_space, chunk_x, 0U);
+
+    ddc::Chunk chunk_x_in(dom_x, ddc::DeviceAllocator<unsigned>());
+    ddc::ChunkSpan const chunk_x_in_view = chunk_x_in.span_view();
+    DElemX const front_x = dom_x.front();
+    ddc::parallel_for_each(
+            exec_space,
+            dom_x,
+            KOKKOS_LAMBDA(DElemX const ix) { chunk_x_in_view(ix) = 1U << (ix - front_x).value(); });
+
+    ddc::experimental::parallel_transform_exclusive_scan(
+            "cumxor",
+            exec_space,
+            ddc::experimental::Dims<DDimX>(),
+            chunk_x,
+            ddc::reducer::bxor<unsigned>(),
+            chunk_x_in.span_cview());
+
+    auto const chunk_x_host = ddc::create_mirror_and_copy(chunk_x.span_cview());
+    unsigned expected = 0;
+    for (DElemX const ix : dom_x) {
+        EXPECT_EQ(chunk_x_host(ix), expected) << "at x=" << ix;
+        expected = (expected << 1) | 1U;
+    }
+}
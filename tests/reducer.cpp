@@ -15,6 +15,13 @@ TEST(Reducer, Sum)
     EXPECT_EQ(reducer(3, -1), 2);
 }
 
+TEST(Reducer, ReproducibleSum)
+{
+    ddc::reducer::reproducible_sum<double> const reducer;
+    EXPECT_EQ(reducer(-1., 3.), 2.);
+    EXPECT_EQ(reducer(3., -1.), 2.);
+}
+
 TEST(Reducer, Prod)
 {
     ddc::reducer::prod<int> const reducer;
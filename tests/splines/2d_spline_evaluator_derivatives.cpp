@@ -224,6 +224,219 @@ void launch_deriv_tests(
     }
 }
 
+template <class ExecSpace, class SplineDerivSpan>
+double max_norm_diff(
+        ExecSpace const& exec_space,
+        SplineDerivSpan const& lhs,
+        SplineDerivSpan const& rhs)
+{
+    using domain = SplineDerivSpan::discrete_domain_type;
+    return ddc::parallel_transform_reduce(
+            exec_space,
+            lhs.domain(),
+            0.,
+            ddc::reducer::max<double>(),
+            KOKKOS_LAMBDA(domain::discrete_element_type const e) {
+                return Kokkos::abs(lhs(e) - rhs(e));
+            });
+}
+
+// Checks that the value and the gradient evaluated in a single pass match the separate
+// evaluations of the value and of each derivative
+template <
+        class DDimI1,
+        class DDimI2,
+        class ExecSpace,
+        class SplineEvaluator,
+        class CoordsSpan,
+        class CoordsFunctor,
+        class CoefSpan,
+        class SplineDerivSpan>
+void test_eval_with_gradient(
+        ExecSpace const& exec_space,
+        SplineEvaluator const& spline_evaluator,
+        CoordsSpan const& coords_eval,
+        CoordsFunctor const& coords_functor,
+        CoefSpan const& coef,
+        SplineDerivSpan const& spline_eval_deriv,
+        evaluator_type<DDimI1, DDimI2> const& evaluator)
+{
+    using I1 = DDimI1::continuous_dimension_type;
+    using I2 = DDimI2::continuous_dimension_type;
+    using memory_space = SplineDerivSpan::memory_space;
+
+    ddc::Chunk spline_eval_alloc(
+            spline_eval_deriv.domain(),
+            ddc::KokkosAllocator<double, memory_space>());
+    ddc::ChunkSpan const spline_eval = spline_eval_alloc.span_view();
+    ddc::Chunk spline_eval_deriv1_alloc(
+            spline_eval_deriv.domain(),
+            ddc::KokkosAllocator<double, memory_space>());
+    ddc::ChunkSpan const spline_eval_deriv1 = spline_eval_deriv1_alloc.span_view();
+    ddc::Chunk spline_eval_deriv2_alloc(
+            spline_eval_deriv.domain(),
+            ddc::KokkosAllocator<double, memory_space>());
+    ddc::ChunkSpan const spline_eval_deriv2 = spline_eval_deriv2_alloc.span_view();
+    ddc::Chunk spline_eval_functor_alloc(
+            spline_eval_deriv.domain(),
+            ddc::KokkosAllocator<double, memory_space>());
+    ddc::ChunkSpan const spline_eval_functor = spline_eval_functor_alloc.span_view();
+    ddc::Chunk spline_eval_deriv1_functor_alloc(
+            spline_eval_deriv.domain(),
+            ddc::KokkosAllocator<double, memory_space>());
+    ddc::ChunkSpan const spline_eval_deriv1_functor = spline_eval_deriv1_functor_alloc.span_view();
+    ddc::Chunk spline_eval_deriv2_functor_alloc(
+            spline_eval_deriv.domain(),
+            ddc::KokkosAllocator<double, memory_space>());
+    ddc::ChunkSpan const spline_eval_deriv2_functor = spline_eval_deriv2_functor_alloc.span_view();
+
+    spline_evaluator.eval_with_gradient(
+            spline_eval,
+            spline_eval_deriv1,
+            spline_eval_deriv2,
+            coords_eval,
+            coef);
+    spline_evaluator.eval_with_gradient(
+            spline_eval_functor,
+            spline_eval_deriv1_functor,
+            spline_eval_deriv2_functor,
+            coords_functor,
+            coef);
+
+    spline_evaluator(spline_eval_deriv, coords_eval, coef);
+    EXPECT_LE(
+            max_norm_diff(exec_space, spline_eval, spline_eval_deriv),
+            1e-12 * evaluator.max_norm(0, 0));
+    EXPECT_LE(
+            max_norm_diff(exec_space, spline_eval_functor, spline_eval_deriv),
+            1e-12 * evaluator.max_norm(0, 0));
+    spline_evaluator
+            .deriv(ddc::DiscreteElement<ddc::Deriv<I1>>(1), spline_eval_deriv, coords_eval, coef);
+    EXPECT_LE(
+            max_norm_diff(exec_space, spline_eval_deriv1, spline_eval_deriv),
+            1e-12 * evaluator.max_norm(1, 0));
+    EXPECT_LE(
+            max_norm_diff(exec_space, spline_eval_deriv1_functor, spline_eval_deriv),
+            1e-12 * evaluator.max_norm(1, 0));
+    spline_evaluator
+            .deriv(ddc::DiscreteElement<ddc::Deriv<I2>>(1), spline_eval_deriv, coords_eval, coef);
+    EXPECT_LE(
+            max_norm_diff(exec_space, spline_eval_deriv2, spline_eval_deriv),
+            1e-12 * evaluator.max_norm(0, 1));
+    EXPECT_LE(
+            max_norm_diff(exec_space, spline_eval_deriv2_functor, spline_eval_deriv),
+            1e-12 * evaluator.max_norm(0, 1));
+}
+
+// Evaluates one of the components returned by eval_with_hessian at each coordinate
+template <
+        class DDimI1,
+        class DDimI2,
+        class ExecSpace,
+        class SplineEvaluator,
+        class CoordsSpan,
+        class CoefSpan,
+        class SplineDerivSpan>
+void eval_hessian_component(
+        ExecSpace const& exec_space,
+        SplineEvaluator const& spline_evaluator,
+        CoordsSpan const& coords_eval,
+        CoefSpan const& coef,
+        SplineDerivSpan const& spline_eval_component,
+        std::size_t const component)
+{
+    using domain = SplineDerivSpan::discrete_domain_type;
+    using batch_element_type
+            = ddc::remove_dims_of_t<domain, DDimI1, DDimI2>::discrete_element_type;
+    ddc::parallel_for_each(
+            exec_space,
+            spline_eval_component.domain(),
+            KOKKOS_LAMBDA(domain::discrete_element_type const e) {
+                spline_eval_component(e) = spline_evaluator.eval_with_hessian(
+                        coords_eval(e),
+                        coef[batch_element_type(e)])[component];
+            });
+}
+
+// Checks that the value, the gradient and the Hessian evaluated in a single pass match the
+// separate evaluations of the value and of each derivative
+template <
+        class DDimI1,
+        class DDimI2,
+        class ExecSpace,
+        class SplineEvaluator,
+        class CoordsSpan,
+        class CoefSpan,
+        class SplineDerivSpan>
+void test_eval_with_hessian(
+        ExecSpace const& exec_space,
+        SplineEvaluator const& spline_evaluator,
+        CoordsSpan const& coords_eval,
+        CoefSpan const& coef,
+        SplineDerivSpan const& spline_eval_deriv,
+        evaluator_type<DDimI1, DDimI2> const& evaluator)
+{
+    using I1 = DDimI1::continuous_dimension_type;
+    using I2 = DDimI2::continuous_dimension_type;
+    using memory_space = SplineDerivSpan::memory_space;
+
+    ddc::Chunk spline_eval_component_alloc(
+            spline_eval_deriv.domain(),
+            ddc::KokkosAllocator<double, memory_space>());
+    ddc::ChunkSpan const spline_eval_component = spline_eval_component_alloc.span_view();
+
+    // Compares a component of eval_with_hessian with the reference stored in spline_eval_deriv
+    auto const check_component
+            = [&](std::size_t const component, int const order1, int const order2) {
+                  eval_hessian_component<DDimI1, DDimI2>(
+                          exec_space,
+                          spline_evaluator,
+                          coords_eval,
+                          coef,
+                          spline_eval_component,
+                          component);
+                  EXPECT_LE(
+                          max_norm_diff(exec_space, spline_eval_component, spline_eval_deriv),
+                          1e-12 * evaluator.max_norm(order1, order2));
+              };
+
+    spline_evaluator(spline_eval_deriv, coords_eval, coef);
+    check_component(0, 0, 0);
+    spline_evaluator
+            .deriv(ddc::DiscreteElement<ddc::Deriv<I1>>(1), spline_eval_deriv, coords_eval, coef);
+    check_component(1, 1, 0);
+    spline_evaluator
+            .deriv(ddc::DiscreteElement<ddc::Deriv<I2>>(1), spline_eval_deriv, coords_eval, coef);
+    check_component(2, 0, 1);
+    // The second derivatives along a dimension of degree 1 are zero
+    if constexpr (s_degree >= 2) {
+        spline_evaluator.deriv(
+                ddc::DiscreteElement<ddc::Deriv<I1>>(2),
+                spline_eval_deriv,
+                coords_eval,
+                coef);
+    } else {
+        ddc::parallel_fill(exec_space, spline_eval_deriv, 0.);
+    }
+    check_component(3, 2, 0);
+    spline_evaluator.deriv(
+            ddc::DiscreteElement<ddc::Deriv<I1>, ddc::Deriv<I2>>(1, 1),
+            spline_eval_deriv,
+            coords_eval,
+            coef);
+    check_component(4, 1, 1);
+    if constexpr (s_degree >= 2) {
+        spline_evaluator.deriv(
+                ddc::DiscreteElement<ddc::Deriv<I2>>(2),
+                spline_eval_deriv,
+                coords_eval,
+                coef);
+    } else {
+        ddc::parallel_fill(exec_space, spline_eval_deriv, 0.);
+    }
+    check_component(5, 0, 2);
+}
+
 // Checks that when evaluating the spline at interpolation points one
 // recovers values that were used to build the spline
 template <
@@ -346,6 +559,29 @@ void TestSplineEvaluator2dDerivatives()
             spline_eval_deriv,
             evaluator,
             ncells);
+
+    // Coordinates of dom_interpolation computed on the fly
+    auto const coords_functor = KOKKOS_LAMBDA(DElem<DDims...> const e)
+    {
+        return ddc::coordinate(DElem<DDimI1, DDimI2>(e));
+    };
+
+    test_eval_with_gradient(
+            exec_space,
+            spline_evaluator,
+            coords_eval.span_cview(),
+            coords_functor,
+            coef.span_cview(),
+            spline_eval_deriv,
+            evaluator);
+
+    test_eval_with_hessian(
+            exec_space,
+            spline_evaluator,
+            coords_eval.span_cview(),
+            coef.span_cview(),
+            spline_eval_deriv,
+            evaluator);
 }
 
 } // namespace anonymous_namespace_workaround_2d_spline_evaluator_derivatives_cpp
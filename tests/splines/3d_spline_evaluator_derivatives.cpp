@@ -265,6 +265,122 @@ void launch_deriv_tests(
     }
 }
 
+template <class ExecSpace, class SplineDerivSpan>
+double max_norm_diff(
+        ExecSpace const& exec_space,
+        SplineDerivSpan const& lhs,
+        SplineDerivSpan const& rhs)
+{
+    using domain = SplineDerivSpan::discrete_domain_type;
+    return ddc::parallel_transform_reduce(
+            exec_space,
+            lhs.domain(),
+            0.,
+            ddc::reducer::max<double>(),
+            KOKKOS_LAMBDA(domain::discrete_element_type const e) {
+                return Kokkos::abs(lhs(e) - rhs(e));
+            });
+}
+
+// Checks that the value and the gradient evaluated in a single pass, at coordinates stored in a
+// ChunkSpan and computed by a functor, match the separate evaluations of the value and of each
+// derivative
+template <
+        class DDimI1,
+        class DDimI2,
+        class DDimI3,
+        class ExecSpace,
+        class SplineEvaluator,
+        class CoordsSpan,
+        class CoordsFunctor,
+        class CoefSpan,
+        class SplineDerivSpan>
+void test_eval_with_gradient(
+        ExecSpace const& exec_space,
+        SplineEvaluator const& spline_evaluator,
+        CoordsSpan const& coords_eval,
+        CoordsFunctor const& coords_functor,
+        CoefSpan const& coef,
+        SplineDerivSpan const& spline_eval_deriv,
+        evaluator_type<DDimI1, DDimI2, DDimI3> const& evaluator)
+{
+    using I1 = DDimI1::continuous_dimension_type;
+    using I2 = DDimI2::continuous_dimension_type;
+    using I3 = DDimI3::continuous_dimension_type;
+    using memory_space = SplineDerivSpan::memory_space;
+
+    // The value and the derivatives along each dimension, at the coordinates stored in a ChunkSpan
+    ddc::Chunk spline_eval_alloc(
+            spline_eval_deriv.domain(),
+            ddc::KokkosAllocator<double, memory_space>());
+    ddc::ChunkSpan const spline_eval = spline_eval_alloc.span_view();
+    ddc::Chunk spline_eval_deriv1_alloc(
+            spline_eval_deriv.domain(),
+            ddc::KokkosAllocator<double, memory_space>());
+    ddc::ChunkSpan const spline_eval_deriv1 = spline_eval_deriv1_alloc.span_view();
+    ddc::Chunk spline_eval_deriv2_alloc(
+            spline_eval_deriv.domain(),
+            ddc::KokkosAllocator<double, memory_space>());
+    ddc::ChunkSpan const spline_eval_deriv2 = spline_eval_deriv2_alloc.span_view();
+    ddc::Chunk spline_eval_deriv3_alloc(
+            spline_eval_deriv.domain(),
+            ddc::KokkosAllocator<double, memory_space>());
+    ddc::ChunkSpan const spline_eval_deriv3 = spline_eval_deriv3_alloc.span_view();
+
+    // The same, at the coordinates computed by the functor
+    ddc::Chunk spline_eval_functor_alloc(
+            spline_eval_deriv.domain(),
+            ddc::KokkosAllocator<double, memory_space>());
+    ddc::ChunkSpan const spline_eval_functor = spline_eval_functor_alloc.span_view();
+    ddc::Chunk spline_eval_deriv1_functor_alloc(
+            spline_eval_deriv.domain(),
+            ddc::KokkosAllocator<double, memory_space>());
+    ddc::ChunkSpan const spline_eval_deriv1_functor = spline_eval_deriv1_functor_alloc.span_view();
+    ddc::Chunk spline_eval_deriv2_functor_alloc(
+            spline_eval_deriv.domain(),
+            ddc::KokkosAllocator<double, memory_space>());
+    ddc::ChunkSpan const spline_eval_deriv2_functor = spline_eval_deriv2_functor_alloc.span_view();
+    ddc::Chunk spline_eval_deriv3_functor_alloc(
+            spline_eval_deriv.domain(),
+            ddc::KokkosAllocator<double, memory_space>());
+    ddc::ChunkSpan const spline_eval_deriv3_functor = spline_eval_deriv3_functor_alloc.span_view();
+
+    spline_evaluator.eval_with_gradient(
+            spline_eval,
+            spline_eval_deriv1,
+            spline_eval_deriv2,
+            spline_eval_deriv3,
+            coords_eval,
+            coef);
+    spline_evaluator.eval_with_gradient(
+            spline_eval_functor,
+            spline_eval_deriv1_functor,
+            spline_eval_deriv2_functor,
+            spline_eval_deriv3_functor,
+            coords_functor,
+            coef);
+
+    // Compares the results of both calls with the reference stored in spline_eval_deriv
+    auto const check_component = [&](SplineDerivSpan const& result,
+                                      SplineDerivSpan const& result_functor,
+                                      double const max_norm) {
+        EXPECT_LE(max_norm_diff(exec_space, result, spline_eval_deriv), 1e-12 * max_norm);
+        EXPECT_LE(max_norm_diff(exec_space, result_functor, spline_eval_deriv), 1e-12 * max_norm);
+    };
+
+    spline_evaluator(spline_eval_deriv, coords_eval, coef);
+    check_component(spline_eval, spline_eval_functor, evaluator.max_norm(0, 0, 0));
+    spline_evaluator
+            .deriv(ddc::DiscreteElement<ddc::Deriv<I1>>(1), spline_eval_deriv, coords_eval, coef);
+    check_component(spline_eval_deriv1, spline_eval_deriv1_functor, evaluator.max_norm(1, 0, 0));
+    spline_evaluator
+            .deriv(ddc::DiscreteElement<ddc::Deriv<I2>>(1), spline_eval_deriv, coords_eval, coef);
+    check_component(spline_eval_deriv2, spline_eval_deriv2_functor, evaluator.max_norm(0, 1, 0));
+    spline_evaluator
+            .deriv(ddc::DiscreteElement<ddc::Deriv<I3>>(1), spline_eval_deriv, coords_eval, coef);
+    check_component(spline_eval_deriv3, spline_eval_deriv3_functor, evaluator.max_norm(0, 0, 1));
+}
+
 // Checks that when evaluating the spline at interpolation points one
 // recovers values that were used to build the spline
 template <
@@ -410,6 +526,21 @@ void TestSplineEvaluator3dDerivatives()
             spline_eval_deriv,
             evaluator,
             ncells);
+
+    // Coordinates of dom_interpolation computed on the fly
+    auto const coords_functor = KOKKOS_LAMBDA(DElem<DDims...> const e)
+    {
+        return ddc::coordinate(DElem<DDimI1, DDimI2, DDimI3>(e));
+    };
+
+    test_eval_with_gradient(
+            exec_space,
+            spline_evaluator,
+            coords_eval.span_cview(),
+            coords_functor,
+            coef.span_cview(),
+            spline_eval_deriv,
+            evaluator);
 }
 
 } // namespace anonymous_namespace_workaround_3d_spline_evaluator_derivatives_cpp
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: MIT
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #if defined(BC_HERMITE)
 #    include <optional>
@@ -194,6 +195,51 @@ double get_max_norm_error_deriv(
             });
 }
 
+template <class ExecSpace, class ChunkSpanType>
+double max_norm_diff(ExecSpace const& exec_space, ChunkSpanType const lhs, ChunkSpanType const rhs)
+{
+    using domain = ChunkSpanType::discrete_domain_type;
+    return ddc::parallel_transform_reduce(
+            exec_space,
+            lhs.domain(),
+            0.,
+            ddc::reducer::max<double>(),
+            KOKKOS_LAMBDA(domain::discrete_element_type const e) {
+                return Kokkos::abs(lhs(e) - rhs(e));
+            });
+}
+
+// Evaluates one of the components returned by eval_with_hessian at each coordinate
+template <
+        typename DDimI1,
+        typename DDimI2,
+        typename DDimI3,
+        typename ExecSpace,
+        typename SplineEvaluator,
+        typename CoordsSpan,
+        typename CoefSpan,
+        typename ChunkSpanType>
+void eval_hessian_component(
+        ExecSpace const& exec_space,
+        SplineEvaluator const& spline_evaluator,
+        CoordsSpan const coords_eval,
+        CoefSpan const coef,
+        ChunkSpanType const spline_eval_component,
+        std::size_t const component)
+{
+    using domain = ChunkSpanType::discrete_domain_type;
+    using batch_element_type
+            = ddc::remove_dims_of_t<domain, DDimI1, DDimI2, DDimI3>::discrete_element_type;
+    ddc::parallel_for_each(
+            exec_space,
+            spline_eval_component.domain(),
+            KOKKOS_LAMBDA(domain::discrete_element_type const e) {
+                spline_eval_component(e) = spline_evaluator.eval_with_hessian(
+                        coords_eval(e),
+                        coef[batch_element_type(e)])[component];
+            });
+}
+
 // Checks that when evaluating the spline at interpolation points one
 // recovers values that were used to build the spline
 template <
@@ -1178,6 +1224,81 @@ void TestBatchedNd3dSpline()
                                 s_degree,
                                 s_degree),
                         1e-6 * max_norm_diff123));
+
+    // Evaluate the value and the gradient in a single pass, at the coordinates stored in a
+    // ChunkSpan then at the same coordinates computed on the fly
+    auto const coords_functor = KOKKOS_LAMBDA(DElem<DDims...> const e)
+    {
+        return ddc::coordinate(DElem<DDimI1, DDimI2, DDimI3>(e));
+    };
+    ddc::Chunk spline_eval_grad_alloc(dom_vals, ddc::KokkosAllocator<double, MemorySpace>());
+    ddc::ChunkSpan const spline_eval_grad = spline_eval_grad_alloc.span_view();
+    ddc::Chunk spline_eval_grad1_alloc(dom_vals, ddc::KokkosAllocator<double, MemorySpace>());
+    ddc::ChunkSpan const spline_eval_grad1 = spline_eval_grad1_alloc.span_view();
+    ddc::Chunk spline_eval_grad2_alloc(dom_vals, ddc::KokkosAllocator<double, MemorySpace>());
+    ddc::ChunkSpan const spline_eval_grad2 = spline_eval_grad2_alloc.span_view();
+    ddc::Chunk spline_eval_grad3_alloc(dom_vals, ddc::KokkosAllocator<double, MemorySpace>());
+    ddc::ChunkSpan const spline_eval_grad3 = spline_eval_grad3_alloc.span_view();
+    for (bool const use_functor : {false, true}) {
+        std::array const spline_eval_grads
+                = {spline_eval_grad1, spline_eval_grad2, spline_eval_grad3};
+        if (use_functor) {
+            spline_evaluator.eval_with_gradient(
+                    spline_eval_grad,
+                    spline_eval_grads,
+                    coords_functor,
+                    coef.span_cview());
+        } else {
+            spline_evaluator.eval_with_gradient(
+                    spline_eval_grad,
+                    spline_eval_grads,
+                    coords_eval.span_cview(),
+                    coef.span_cview());
+        }
+        EXPECT_LE(max_norm_diff(exec_space, spline_eval_grad, spline_eval), 1e-12 * max_norm);
+        EXPECT_LE(
+                max_norm_diff(exec_space, spline_eval_grad1, spline_eval_deriv1),
+                1e-12 * max_norm_diff1);
+        EXPECT_LE(
+                max_norm_diff(exec_space, spline_eval_grad2, spline_eval_deriv2),
+                1e-12 * max_norm_diff2);
+        EXPECT_LE(
+                max_norm_diff(exec_space, spline_eval_grad3, spline_eval_deriv3),
+                1e-12 * max_norm_diff3);
+    }
+
+    // The mixed second derivatives of eval_with_hessian, stored after the value, the gradient
+    // and the diagonal term of the row
+    eval_hessian_component<DDimI1, DDimI2, DDimI3>(
+            exec_space,
+            spline_evaluator,
+            coords_eval.span_cview(),
+            coef.span_cview(),
+            spline_eval_grad,
+            5);
+    EXPECT_LE(
+            max_norm_diff(exec_space, spline_eval_grad, spline_eval_deriv12),
+            1e-12 * max_norm_diff12);
+    eval_hessian_component<DDimI1, DDimI2, DDimI3>(
+            exec_space,
+            spline_evaluator,
+            coords_eval.span_cview(),
+            coef.span_cview(),
+            spline_eval_grad,
+            6);
+    EXPECT_LE(
+            max_norm_diff(exec_space, spline_eval_grad, spline_eval_deriv13),
+            1e-12 * max_norm_diff13);
+    eval_hessian_component<DDimI1, DDimI2, DDimI3>(
+            exec_space,
+            spline_evaluator,
+            coords_eval.span_cview(),
+            coef.span_cview(),
+            spline_eval_grad,
+            8);
+    EXPECT_LE(
+            max_norm_diff(exec_space, spline_eval_grad, spline_eval_deriv23),
+            1e-12 * max_norm_diff23);
 }
 
 } // namespace anonymous_namespace_workaround_batched_nd_evaluator_3d_spline_builder_cpp
@@ -288,6 +288,11 @@ void TestBatchedSpline()
     ddc::ChunkSpan const spline_eval_deriv = spline_eval_deriv_alloc.span_view();
     ddc::Chunk spline_eval_integrals_alloc(dom_batch, ddc::KokkosAllocator<double, MemorySpace>());
     ddc::ChunkSpan const spline_eval_integrals = spline_eval_integrals_alloc.span_view();
+    ddc::Chunk spline_eval_integrals_cached_alloc(
+            dom_batch,
+            ddc::KokkosAllocator<double, MemorySpace>());
+    ddc::ChunkSpan const spline_eval_integrals_cached
+            = spline_eval_integrals_cached_alloc.span_view();
 
     // Call spline_evaluator on the same mesh we started with
     spline_evaluator_batched(spline_eval, coords_eval.span_cview(), coef.span_cview());
@@ -297,6 +302,30 @@ void TestBatchedSpline()
                    coords_eval.span_cview(),
                    coef.span_cview());
     spline_evaluator_batched.integrate(spline_eval_integrals, coef.span_cview());
+    // The second integration uses the integrals of the B-splines cached by the first one
+    spline_evaluator_batched.integrate(spline_eval_integrals_cached, coef.span_cview());
+
+    // Reference integrals, recomputing the integrals of the B-splines
+    ddc::Chunk bsplines_integrals_alloc(
+            ddc::DiscreteDomain<BSplines<I>>(dom_spline),
+            ddc::KokkosAllocator<double, MemorySpace>());
+    ddc::ChunkSpan const bsplines_integrals = bsplines_integrals_alloc.span_view();
+    ddc::integrals(exec_space, bsplines_integrals);
+    ddc::Chunk spline_eval_integrals_ref_alloc(
+            dom_batch,
+            ddc::KokkosAllocator<double, MemorySpace>());
+    ddc::ChunkSpan const spline_eval_integrals_ref = spline_eval_integrals_ref_alloc.span_view();
+    ddc::parallel_for_each(
+            exec_space,
+            dom_batch,
+            KOKKOS_LAMBDA(
+                    decltype(spline_builder)::template batch_domain_type<
+                            ddc::DiscreteDomain<DDims...>>::discrete_element_type const j) {
+                spline_eval_integrals_ref(j) = 0;
+                for (DElem<BSplines<I>> const i : bsplines_integrals.domain()) {
+                    spline_eval_integrals_ref(j) += coef(i, j) * bsplines_integrals(i);
+                }
+            });
 
     // Checking errors (we recover the initial values)
     double const max_norm_error = ddc::parallel_transform_reduce(
@@ -329,6 +358,18 @@ void TestBatchedSpline()
                         spline_eval_integrals(e) - evaluator.deriv(xn<I>(), -1)
                         + evaluator.deriv(x0<I>(), -1));
             });
+    double const max_norm_error_integ_ref = ddc::parallel_transform_reduce(
+            exec_space,
+            spline_eval_integrals.domain(),
+            0.,
+            ddc::reducer::max<double>(),
+            KOKKOS_LAMBDA(
+                    decltype(spline_builder)::template batch_domain_type<
+                            ddc::DiscreteDomain<DDims...>>::discrete_element_type const e) {
+                return Kokkos::max(
+                        Kokkos::abs(spline_eval_integrals(e) - spline_eval_integrals_ref(e)),
+                        Kokkos::abs(spline_eval_integrals_cached(e) - spline_eval_integrals_ref(e)));
+            });
 
     double const max_norm = evaluator.max_norm();
     double const max_norm_diff = evaluator.max_norm(1);
@@ -348,6 +389,7 @@ void TestBatchedSpline()
             std::
                     max(error_bounds.error_bound_on_int(dx<I>(ncells), s_degree),
                         1.0e-14 * max_norm_int));
+    EXPECT_LE(max_norm_error_integ_ref, 1.0e-14 * max_norm_int);
 }
 
 } // namespace anonymous_namespace_workaround_batched_spline_builder_cpp
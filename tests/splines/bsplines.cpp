@@ -136,6 +136,54 @@ TYPED_TEST(BSplinesFixture, PartitionOfUnityNonUniform)
     }
 }
 
+TYPED_TEST(BSplinesFixture, EvalBasisNearNonUniform)
+{
+    std::size_t constexpr degree = TestFixture::spline_degree;
+    using DimX = TestFixture::DimX;
+    using BSplinesX = TestFixture::NUBSplinesX;
+    using CoordX = ddc::Coordinate<DimX>;
+    CoordX const xmin(0.0);
+    CoordX const xmax(0.2);
+    std::size_t const ncells = TestFixture::ncells;
+    std::vector<CoordX> breaks(ncells + 1);
+    for (std::size_t i(0); i < ncells + 1; ++i) {
+        double const s = static_cast<double>(i) / ncells;
+        breaks[i] = CoordX(xmin + (xmax - xmin) * s * s);
+    }
+    ddc::init_discrete_space<BSplinesX>(breaks);
+    ddc::DiscreteDomain<BSplinesX> const bspl_full_domain
+            = ddc::discrete_space<BSplinesX>().full_domain();
+
+    std::array<double, degree + 1> values_ptr;
+    Kokkos::mdspan<double, Kokkos::extents<std::size_t, degree + 1>> const values(
+            values_ptr.data());
+    std::array<double, degree + 1> values_near_ptr;
+    Kokkos::mdspan<double, Kokkos::extents<std::size_t, degree + 1>> const values_near(
+            values_near_ptr.data());
+
+    std::size_t const n_test_points = ncells * 30;
+    double const dx = (xmax - xmin) / (n_test_points - 1);
+
+    ddc::DiscreteElement<BSplinesX> jmin_hint = bspl_full_domain.front();
+    for (std::size_t i(0); i < n_test_points; ++i) {
+        CoordX const test_point(xmin + dx * i);
+        ddc::DiscreteElement<BSplinesX> const jmin
+                = ddc::discrete_space<BSplinesX>().eval_basis(values, test_point);
+        // walking from the previous point
+        jmin_hint = ddc::discrete_space<BSplinesX>()
+                            .eval_basis_near(values_near, test_point, jmin_hint);
+        EXPECT_EQ(jmin_hint, jmin);
+        for (std::size_t j(0); j < degree + 1; ++j) {
+            EXPECT_EQ(DDC_MDSPAN_ACCESS_OP(values_near, j), DDC_MDSPAN_ACCESS_OP(values, j));
+        }
+        // walking from the other end
+        EXPECT_EQ(
+                ddc::discrete_space<BSplinesX>()
+                        .eval_basis_near(values_near, test_point, bspl_full_domain.back()),
+                jmin);
+    }
+}
+
 TEST(KnotDiscreteDimension, Type)
 {
     struct DDim1 : ddc::UniformBSplines<struct X, 1>
@@ -205,6 +205,47 @@ void TestPeriodicSplineBuilderTestIdentity()
     EXPECT_LE(
             max_norm_error_quadrature_integ,
             std::max(error_bounds.error_bound_on_int(h, s_degree), 1.0e-14 * max_norm_int));
+
+    // 9. Checking the evaluation on a mesh shifted by a constant displacement
+    double const shift = 0.0176429863;
+    ddc::parallel_for_each(
+            execution_space(),
+            interpolation_domain,
+            KOKKOS_LAMBDA(DElemX const ix) {
+                coords_eval(ix) = CoordX(ddc::coordinate(ix) - shift);
+            });
+    spline_evaluator(spline_eval.span_view(), coords_eval.span_cview(), coef.span_cview());
+
+    ddc::Chunk spline_eval_shifted_alloc(
+            interpolation_domain,
+            ddc::KokkosAllocator<double, memory_space>());
+    ddc::ChunkSpan const spline_eval_shifted(spline_eval_shifted_alloc.span_view());
+    spline_evaluator.eval_shifted(spline_eval_shifted, shift, coef.span_cview());
+
+    double const max_norm_error_shifted = ddc::parallel_transform_reduce(
+            execution_space(),
+            interpolation_domain,
+            0.0,
+            ddc::reducer::max<double>(),
+            KOKKOS_LAMBDA(DElemX const ix) {
+                return Kokkos::fabs(spline_eval_shifted(ix) - spline_eval(ix));
+            });
+    EXPECT_LE(max_norm_error_shifted, 1.0e-14 * max_norm);
+
+    // 10. Checking the evaluation at coordinates computed on the fly
+    spline_evaluator(
+            spline_eval_shifted,
+            KOKKOS_LAMBDA(DElemX const ix) { return CoordX(ddc::coordinate(ix) - shift); },
+            coef.span_cview());
+    double const max_norm_error_functor = ddc::parallel_transform_reduce(
+            execution_space(),
+            interpolation_domain,
+            0.0,
+            ddc::reducer::max<double>(),
+            KOKKOS_LAMBDA(DElemX const ix) {
+                return Kokkos::fabs(spline_eval_shifted(ix) - spline_eval(ix));
+            });
+    EXPECT_EQ(max_norm_error_functor, 0.);
 }
 
 TEST(PeriodicSplineBuilderTest, Identity)
@@ -0,0 +1,246 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+#include <ddc/kernels/splines.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+inline namespace anonymous_namespace_workaround_spline_evaluation_order_cpp {
+
+struct DimX
+{
+    static constexpr bool PERIODIC = true;
+};
+
+using CoordX = ddc::Coordinate<DimX>;
+
+struct BSplinesX : ddc::NonUniformBSplines<DimX, 3>
+{
+};
+
+struct DDimX
+{
+};
+
+struct DDimB
+{
+};
+
+using DElemXB = ddc::DiscreteElement<DDimX, DDimB>;
+
+using execution_space = Kokkos::DefaultExecutionSpace;
+using memory_space = execution_space::memory_space;
+
+using SplineEvaluatorX = ddc::SplineEvaluator<
+        execution_space,
+        memory_space,
+        BSplinesX,
+        DDimX,
+        ddc::PeriodicExtrapolationRule<DimX>,
+        ddc::PeriodicExtrapolationRule<DimX>>;
+
+std::size_t constexpr s_ncells = 10;
+
+std::size_t constexpr s_npoints = 32;
+
+std::size_t constexpr s_nlines = 8;
+
+/// Each line is a permutation of a mesh of [0, 1[, i.e. the coordinates are unsorted
+struct ScrambledLine
+{
+    KOKKOS_FUNCTION CoordX operator()(DElemXB const e) const
+    {
+        std::size_t const i = ddc::DiscreteElement<DDimX>(e).uid();
+        std::size_t const b = ddc::DiscreteElement<DDimB>(e).uid();
+        // 7 is coprime with s_npoints
+        return CoordX(((7 * i + 3 * b) % s_npoints + 0.5) / s_npoints);
+    }
+};
+
+/// Each line is sorted and wraps twice around the periodic domain [0, 1]
+struct WrappingLine
+{
+    KOKKOS_FUNCTION CoordX operator()(DElemXB const e) const
+    {
+        std::size_t const i = ddc::DiscreteElement<DDimX>(e).uid();
+        std::size_t const b = ddc::DiscreteElement<DDimB>(e).uid();
+        return CoordX(0.4 + 1.7 * (i + 0.5) / s_npoints + 0.01 * (b % 16));
+    }
+};
+
+/// Counts the calls to a coordinate functor
+template <class CoordsFunctor>
+struct CountingLine
+{
+    CoordsFunctor coords;
+
+    Kokkos::View<std::size_t, memory_space> count;
+
+    KOKKOS_FUNCTION CoordX operator()(DElemXB const e) const
+    {
+        Kokkos::atomic_inc(&count());
+        return coords(e);
+    }
+};
+
+void init_bsplines()
+{
+    if (ddc::is_discrete_space_initialized<BSplinesX>()) {
+        return;
+    }
+    // non-uniform break points so that the cells are found by walking
+    std::vector<CoordX> breaks(s_ncells + 1);
+    for (std::size_t i(0); i < s_ncells + 1; ++i) {
+        double const s = static_cast<double>(i) / s_ncells;
+        breaks[i] = CoordX(s * s);
+    }
+    ddc::init_discrete_space<BSplinesX>(breaks);
+}
+
+/// Checks an evaluator against the reference, at stored coordinates and with a functor
+template <class CoordsFunctor, class CoordsSpan, class CoefSpan, class EvalSpan>
+void TestSplineEvaluator(
+        SplineEvaluatorX const& spline_evaluator,
+        CoordsFunctor const& coords_functor,
+        CoordsSpan const coords_eval,
+        CoefSpan const coef,
+        EvalSpan const spline_eval_ref)
+{
+    ddc::Chunk spline_eval_alloc(
+            spline_eval_ref.domain(),
+            ddc::KokkosAllocator<double, memory_space>());
+    ddc::ChunkSpan const spline_eval = spline_eval_alloc.span_view();
+
+    spline_evaluator(spline_eval, coords_eval, coef);
+    double const max_norm_error = ddc::parallel_transform_reduce(
+            execution_space(),
+            spline_eval.domain(),
+            0.0,
+            ddc::reducer::max<double>(),
+            KOKKOS_LAMBDA(DElemXB const e) {
+                return Kokkos::fabs(spline_eval(e) - spline_eval_ref(e));
+            });
+    EXPECT_LE(max_norm_error, 1e-14);
+
+    // each coordinate is computed once
+    CountingLine<CoordsFunctor> const
+            counting_functor {coords_functor, Kokkos::View<std::size_t, memory_space>("count")};
+    spline_evaluator(spline_eval, counting_functor, coef);
+    std::size_t count = 0;
+    Kokkos::deep_copy(count, counting_functor.count);
+    EXPECT_EQ(count, spline_eval.domain().size());
+    double const max_norm_error_functor = ddc::parallel_transform_reduce(
+            execution_space(),
+            spline_eval.domain(),
+            0.0,
+            ddc::reducer::max<double>(),
+            KOKKOS_LAMBDA(DElemXB const e) {
+                return Kokkos::fabs(spline_eval(e) - spline_eval_ref(e));
+            });
+    EXPECT_LE(max_norm_error_functor, 1e-14);
+}
+
+template <class CoordsFunctor>
+void TestSplineEvaluationOrder(CoordsFunctor const& coords_functor)
+{
+    init_bsplines();
+
+    ddc::DiscreteDomain<DDimB> const batch_domain(
+            ddc::DiscreteElement<DDimB>(0),
+            ddc::DiscreteVector<DDimB>(s_nlines));
+    ddc::DiscreteDomain<DDimX, DDimB> const evaluation_domain(
+            ddc::DiscreteDomain<DDimX>(
+                    ddc::DiscreteElement<DDimX>(0),
+                    ddc::DiscreteVector<DDimX>(s_npoints)),
+            batch_domain);
+    ddc::DiscreteDomain<BSplinesX, DDimB> const spline_domain(
+            ddc::discrete_space<BSplinesX>().full_domain(),
+            batch_domain);
+
+    ddc::Chunk coef_alloc(spline_domain, ddc::KokkosAllocator<double, memory_space>());
+    ddc::ChunkSpan const coef = coef_alloc.span_view();
+    ddc::parallel_for_each(
+            execution_space(),
+            spline_domain,
+            KOKKOS_LAMBDA(ddc::DiscreteElement<BSplinesX, DDimB> const e) {
+                double const j = ddc::DiscreteElement<BSplinesX>(e).uid();
+                double const b = ddc::DiscreteElement<DDimB>(e).uid();
+                coef(e) = Kokkos::cos(1.3 * j + 0.7 * b);
+            });
+
+    ddc::Chunk
+            coords_eval_alloc(evaluation_domain, ddc::KokkosAllocator<CoordX, memory_space>());
+    ddc::ChunkSpan const coords_eval = coords_eval_alloc.span_view();
+    ddc::parallel_for_each(
+            execution_space(),
+            evaluation_domain,
+            KOKKOS_LAMBDA(DElemXB const e) { coords_eval(e) = coords_functor(e); });
+
+    ddc::PeriodicExtrapolationRule<DimX> const periodic_extrapolation;
+    SplineEvaluatorX const spline_evaluator_unsorted(
+            periodic_extrapolation,
+            periodic_extrapolation,
+            ddc::SplineEvaluationOrder::UNSORTED);
+    ddc::Chunk spline_eval_ref_alloc(
+            evaluation_domain,
+            ddc::KokkosAllocator<double, memory_space>());
+    ddc::ChunkSpan const spline_eval_ref = spline_eval_ref_alloc.span_view();
+    spline_evaluator_unsorted(spline_eval_ref, coords_eval.span_cview(), coef.span_cview());
+
+    // a threshold of 0 evaluates the points independently, an infinite one walks each line
+    for (double const small_batch_threshold : {0., std::numeric_limits<double>::infinity()}) {
+        for (ddc::SplineEvaluationOrder const evaluation_order :
+             {ddc::SplineEvaluationOrder::UNSORTED,
+              ddc::SplineEvaluationOrder::SORTED,
+              ddc::SplineEvaluationOrder::DETECT}) {
+            TestSplineEvaluator(
+                    SplineEvaluatorX(
+                            periodic_extrapolation,
+                            periodic_extrapolation,
+                            evaluation_order,
+                            small_batch_threshold),
+                    coords_functor,
+                    coords_eval.span_cview(),
+                    coef.span_cview(),
+                    spline_eval_ref.span_cview());
+        }
+    }
+}
+
+} // namespace anonymous_namespace_workaround_spline_evaluation_order_cpp
+
+TEST(SplineEvaluationOrder, UnsortedLine)
+{
+    TestSplineEvaluationOrder(ScrambledLine());
+}
+
+TEST(SplineEvaluationOrder, PeriodicWrappingLine)
+{
+    TestSplineEvaluationOrder(WrappingLine());
+}
+
+TEST(BatchParallelism, IsSmallBatch)
+{
+    execution_space const exec_space;
+    std::size_t const concurrency = exec_space.concurrency();
+    // a single line of many points runs over its points if there are threads to spare
+    EXPECT_EQ(ddc::detail::is_small_batch(exec_space, 1, 2 * concurrency), concurrency >= 2);
+    // lines of a single point gain nothing
+    EXPECT_FALSE(ddc::detail::is_small_batch(exec_space, concurrency / 4, 1));
+    // a batch filling the execution space keeps one line per thread
+    EXPECT_FALSE(ddc::detail::is_small_batch(exec_space, concurrency, 100));
+    EXPECT_TRUE(ddc::detail::is_small_batch(exec_space, concurrency, 100, 0.));
+    EXPECT_FALSE(ddc::detail::is_small_batch(
+            exec_space,
+            1,
+            2 * concurrency,
+            std::numeric_limits<double>::infinity()));
+}
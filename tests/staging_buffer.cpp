@@ -0,0 +1,137 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+inline namespace anonymous_namespace_workaround_staging_buffer_cpp {
+
+struct DDimX
+{
+};
+using DElemX = ddc::DiscreteElement<DDimX>;
+using DVectX = ddc::DiscreteVector<DDimX>;
+using DDomX = ddc::DiscreteDomain<DDimX>;
+
+} // namespace anonymous_namespace_workaround_staging_buffer_cpp
+
+TEST(StagingBuffer, Reuse)
+{
+    ddc::detail::clear_staging_pool();
+    void* ptr = nullptr;
+    {
+        ddc::detail::StagingBuffer const buffer(100);
+        ptr = buffer.data();
+        EXPECT_NE(ptr, nullptr);
+        EXPECT_EQ(buffer.size(), 100U);
+    }
+    EXPECT_EQ(ddc::detail::staging_pool_size(), 1U);
+    {
+        ddc::detail::StagingBuffer const buffer(50);
+        EXPECT_EQ(buffer.data(), ptr);
+        EXPECT_EQ(buffer.size(), 100U);
+        EXPECT_EQ(ddc::detail::staging_pool_size(), 0U);
+        ddc::detail::StagingBuffer const larger_buffer(200);
+        EXPECT_NE(larger_buffer.data(), ptr);
+        EXPECT_EQ(larger_buffer.size(), 200U);
+    }
+    EXPECT_EQ(ddc::detail::staging_pool_size(), 2U);
+    ddc::detail::clear_staging_pool();
+    EXPECT_EQ(ddc::detail::staging_pool_size(), 0U);
+}
+
+TEST(StagingBuffer, BorrowedAcrossClear)
+{
+    ddc::detail::clear_staging_pool();
+    {
+        ddc::detail::StagingBuffer const buffer(100);
+        ddc::detail::clear_staging_pool();
+        EXPECT_EQ(ddc::detail::staging_pool_size(), 0U);
+    }
+    // The buffer borrowed before the clear is freed instead of returning to the pool
+    EXPECT_EQ(ddc::detail::staging_pool_size(), 0U);
+    {
+        ddc::detail::StagingBuffer const buffer(100);
+    }
+    EXPECT_EQ(ddc::detail::staging_pool_size(), 1U);
+    ddc::detail::clear_staging_pool();
+}
+
+TEST(StagingBuffer, Finalized)
+{
+    ddc::detail::StagingBuffer held_buffer(100);
+    ddc::detail::finalize_staging_pool();
+    EXPECT_EQ(ddc::detail::staging_pool_size(), 0U);
+    held_buffer = ddc::detail::StagingBuffer();
+    {
+        ddc::detail::StagingBuffer const buffer(100);
+    }
+    // Once finalized, all the buffers are freed on their return
+    EXPECT_EQ(ddc::detail::staging_pool_size(), 0U);
+    ddc::detail::initialize_staging_pool();
+    {
+        ddc::detail::StagingBuffer const buffer(100);
+    }
+    EXPECT_EQ(ddc::detail::staging_pool_size(), 1U);
+    ddc::detail::clear_staging_pool();
+}
+
+TEST(StagingBuffer, Capacity)
+{
+    ddc::detail::clear_staging_pool();
+    std::size_t const capacity = ddc::detail::staging_pool_capacity();
+    ddc::detail::set_staging_pool_capacity(250);
+    {
+        ddc::detail::StagingBuffer const small_buffer(50);
+        ddc::detail::StagingBuffer const medium_buffer(100);
+        ddc::detail::StagingBuffer const large_buffer(200);
+    }
+    // the largest buffer is freed so that the available buffers fit in the capacity
+    EXPECT_EQ(ddc::detail::staging_pool_size(), 2U);
+    EXPECT_EQ(ddc::detail::staging_pool_nbytes(), 150U);
+    {
+        // a buffer larger than the capacity never stays in the pool
+        ddc::detail::StagingBuffer const buffer(300);
+    }
+    EXPECT_EQ(ddc::detail::staging_pool_nbytes(), 150U);
+    ddc::detail::set_staging_pool_capacity(60);
+    EXPECT_EQ(ddc::detail::staging_pool_size(), 1U);
+    EXPECT_EQ(ddc::detail::staging_pool_nbytes(), 50U);
+    ddc::detail::set_staging_pool_capacity(capacity);
+    ddc::detail::clear_staging_pool();
+    EXPECT_EQ(ddc::detail::staging_pool_nbytes(), 0U);
+}
+
+TEST(StagingBuffer, StageDeviceChunk)
+{
+    DDomX const dom(DElemX(0), DVectX(10));
+    ddc::Chunk chunk(dom, ddc::DeviceAllocator<int>());
+    ddc::ChunkSpan const chunk_span = chunk.span_view();
+    ddc::parallel_for_each(
+            dom,
+            KOKKOS_LAMBDA(DElemX const ix) { chunk_span(ix) = 2 * (ix - DElemX(0)).value(); });
+    ddc::detail::StagingBuffer buffer;
+    auto const staged = ddc::detail::stage_to_host(buffer, chunk.span_cview());
+    EXPECT_GE(buffer.size(), dom.size() * sizeof(int));
+    EXPECT_EQ(staged.domain(), dom);
+    for (DElemX const ix : dom) {
+        EXPECT_EQ(staged(ix), 2 * (ix - DElemX(0)).value());
+    }
+}
+
+TEST(StagingBuffer, PinnedMirror)
+{
+    DDomX const dom(DElemX(0), DVectX(10));
+    ddc::Chunk chunk(dom, ddc::DeviceAllocator<int>());
+    ddc::parallel_fill(chunk, 3);
+    auto const mirror = ddc::create_mirror_and_copy(ddc::PinnedHostSpace(), chunk.span_cview());
+    for (DElemX const ix : dom) {
+        EXPECT_EQ(mirror(ix), 3);
+    }
+}
@@ -0,0 +1,120 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <type_traits>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+inline namespace anonymous_namespace_workaround_static_discrete_domain_cpp {
+
+struct DDimX
+{
+};
+using DElemX = ddc::DiscreteElement<DDimX>;
+using DVectX = ddc::DiscreteVector<DDimX>;
+using DDomX = ddc::DiscreteDomain<DDimX>;
+
+struct DDimV
+{
+};
+using DElemV = ddc::DiscreteElement<DDimV>;
+using DVectV = ddc::DiscreteVector<DDimV>;
+using DDomV = ddc::DiscreteDomain<DDimV>;
+
+using DElemXV = ddc::DiscreteElement<DDimX, DDimV>;
+using DVectXV = ddc::DiscreteVector<DDimX, DDimV>;
+using DDomXV = ddc::DiscreteDomain<DDimX, DDimV>;
+
+using SDDomV = ddc::StaticDiscreteDomain<DDomV, 3>;
+using SDDomXV = ddc::StaticDiscreteDomain<DDomXV, Kokkos::dynamic_extent, 3>;
+
+DElemX constexpr lbound_x = ddc::init_trivial_half_bounded_space<DDimX>();
+DVectX constexpr nelems_x(10);
+
+DElemV constexpr lbound_v = ddc::init_trivial_half_bounded_space<DDimV>();
+DVectV constexpr nelems_v(3);
+
+DElemXV constexpr lbound_x_v(lbound_x, lbound_v);
+DVectXV constexpr nelems_x_v(nelems_x, nelems_v);
+
+} // namespace anonymous_namespace_workaround_static_discrete_domain_cpp
+
+TEST(StaticDiscreteDomain, Constructor)
+{
+    SDDomV const dom_v(lbound_v);
+    EXPECT_EQ(dom_v.front(), lbound_v);
+    EXPECT_EQ(dom_v.extents(), nelems_v);
+    EXPECT_EQ(dom_v.size(), 3U);
+
+    SDDomXV const dom_x_v(DDomX(lbound_x, nelems_x), dom_v);
+    EXPECT_EQ(dom_x_v, DDomXV(lbound_x_v, nelems_x_v));
+    EXPECT_EQ(SDDomXV(lbound_x_v, nelems_x_v), dom_x_v);
+    EXPECT_EQ(dom_x_v.extent<DDimV>(), nelems_v);
+    EXPECT_EQ(dom_x_v.extent<DDimX>(), nelems_x);
+    EXPECT_EQ(dom_x_v.size(), static_cast<std::size_t>(nelems_x.value() * nelems_v.value()));
+    EXPECT_TRUE(ddc::is_discrete_domain_v<SDDomXV>);
+    EXPECT_TRUE(ddc::is_static_discrete_domain_v<SDDomXV>);
+}
+
+TEST(StaticDiscreteDomain, ChunkExtents)
+{
+    using ChunkXV = ddc::Chunk<double, SDDomXV>;
+    EXPECT_TRUE((std::is_same_v<
+                 ChunkXV::extents_type,
+                 Kokkos::extents<std::size_t, Kokkos::dynamic_extent, 3>>));
+    EXPECT_EQ(ChunkXV::rank_dynamic(), 1);
+    EXPECT_EQ(ChunkXV::static_extent(1), 3U);
+
+    SDDomXV const dom_x_v(lbound_x_v, nelems_x_v);
+    ChunkXV chunk(dom_x_v);
+    EXPECT_EQ(chunk.allocation_mdspan().extent(0), 10U);
+    EXPECT_EQ(chunk.allocation_mdspan().extent(1), 3U);
+    ddc::host_for_each(dom_x_v, [&](DElemXV const ixv) {
+        chunk(ixv) = 10. * (DElemX(ixv) - lbound_x).value() + (DElemV(ixv) - lbound_v).value();
+    });
+    EXPECT_EQ(chunk(lbound_x_v + DVectXV(2, 1)), 21.);
+}
+
+TEST(StaticDiscreteDomain, Slice)
+{
+    SDDomXV const dom_x_v(lbound_x_v, nelems_x_v);
+    ddc::Chunk chunk(dom_x_v, ddc::HostAllocator<double>());
+    ddc::parallel_fill(chunk, 1.);
+
+    // Slicing out the dynamic dimension keeps the static one
+    auto const chunk_v = chunk[lbound_x + DVectX(2)];
+    EXPECT_TRUE((std::is_same_v<decltype(chunk_v)::discrete_domain_type, SDDomV>));
+    EXPECT_TRUE((std::is_same_v<
+                 decltype(chunk_v)::extents_type,
+                 Kokkos::extents<std::size_t, 3>>));
+    EXPECT_EQ(chunk_v(lbound_v + DVectV(1)), 1.);
+
+    // Slicing out the static dimension gives a dynamic domain
+    auto const chunk_x = chunk[lbound_v + DVectV(1)];
+    EXPECT_TRUE((std::is_same_v<decltype(chunk_x)::discrete_domain_type, DDomX>));
+
+    // Restricting to a subdomain gives a dynamic domain
+    auto const chunk_sub = chunk[DDomXV(lbound_x_v, DVectXV(2, 2))];
+    EXPECT_TRUE((std::is_same_v<decltype(chunk_sub)::discrete_domain_type, DDomXV>));
+    EXPECT_EQ(chunk_sub(lbound_x_v + DVectXV(1, 1)), 1.);
+}
+
+TEST(StaticDiscreteDomain, ParallelForEach)
+{
+    SDDomXV const dom_x_v(lbound_x_v, nelems_x_v);
+    ddc::Chunk chunk_alloc(dom_x_v, ddc::DeviceAllocator<int>());
+    ddc::ChunkSpan const chunk = chunk_alloc.span_view();
+    ddc::parallel_for_each(dom_x_v, KOKKOS_LAMBDA(DElemXV const ixv) { chunk(ixv) = 1; });
+    int const sum = ddc::parallel_transform_reduce(
+            dom_x_v,
+            0,
+            ddc::reducer::sum<int>(),
+            KOKKOS_LAMBDA(DElemXV const ixv) { return chunk(ixv); });
+    EXPECT_EQ(static_cast<std::size_t>(sum), dom_x_v.size());
+}
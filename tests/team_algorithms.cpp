@@ -0,0 +1,169 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+inline namespace anonymous_namespace_workaround_team_algorithms_cpp {
+
+using DDom0D = ddc::DiscreteDomain<>;
+
+struct DDimX
+{
+};
+using DElemX = ddc::DiscreteElement<DDimX>;
+using DVectX = ddc::DiscreteVector<DDimX>;
+using DDomX = ddc::DiscreteDomain<DDimX>;
+
+struct DDimY
+{
+};
+using DElemY = ddc::DiscreteElement<DDimY>;
+using DVectY = ddc::DiscreteVector<DDimY>;
+using DDomY = ddc::DiscreteDomain<DDimY>;
+
+using DElemXY = ddc::DiscreteElement<DDimX, DDimY>;
+using DVectXY = ddc::DiscreteVector<DDimX, DDimY>;
+using DDomXY = ddc::DiscreteDomain<DDimX, DDimY>;
+
+DElemX constexpr lbound_x = ddc::init_trivial_half_bounded_space<DDimX>();
+DVectX constexpr nelems_x(10);
+
+DElemY constexpr lbound_y = ddc::init_trivial_half_bounded_space<DDimY>();
+DVectY constexpr nelems_y(12);
+
+DElemXY constexpr lbound_x_y(lbound_x, lbound_y);
+DVectXY constexpr nelems_x_y(nelems_x, nelems_y);
+
+int constexpr nteams = 3;
+
+template <class Support>
+void TestTeamForEach(Support const& dom)
+{
+    ddc::Chunk chunk(dom, ddc::DeviceAllocator<int>());
+    ddc::ChunkSpan const chunk_span = chunk.span_view();
+    ddc::parallel_fill(chunk_span, 0);
+    Kokkos::parallel_for(
+            Kokkos::TeamPolicy<>(nteams, Kokkos::AUTO, Kokkos::AUTO),
+            KOKKOS_LAMBDA(Kokkos::TeamPolicy<>::member_type const& team) {
+                ddc::team_for_each(
+                        team,
+                        dom,
+                        [&](typename Support::discrete_element_type const i) {
+                            Kokkos::atomic_add(&chunk_span(i), 1);
+                        });
+            });
+    auto const chunk_host = ddc::create_mirror_view_and_copy(chunk_span);
+    ddc::host_for_each(dom, [&](typename Support::discrete_element_type const i) {
+        EXPECT_EQ(chunk_host(i), nteams);
+    });
+}
+
+template <class Support>
+void TestTeamTransformReduce(Support const& dom, int const neutral = 0)
+{
+    ddc::Chunk chunk_host(dom, ddc::HostAllocator<int>());
+    int count = 0;
+    ddc::host_for_each(dom, [&](typename Support::discrete_element_type const i) {
+        chunk_host(i) = count++;
+    });
+    auto const chunk = ddc::create_mirror_view_and_copy(
+            Kokkos::DefaultExecutionSpace(),
+            chunk_host.span_view());
+    ddc::ChunkSpan const chunk_span = chunk.span_cview();
+    Kokkos::View<int*> const results("results", nteams);
+    Kokkos::parallel_for(
+            Kokkos::TeamPolicy<>(nteams, Kokkos::AUTO, Kokkos::AUTO),
+            KOKKOS_LAMBDA(Kokkos::TeamPolicy<>::member_type const& team) {
+                int const result = ddc::team_transform_reduce(
+                        team,
+                        dom,
+                        neutral,
+                        ddc::reducer::sum<int>(),
+                        chunk_span);
+                Kokkos::single(Kokkos::PerTeam(team), [&]() {
+                    results(team.league_rank()) = result;
+                });
+            });
+    auto const results_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), results);
+    for (int i = 0; i < nteams; ++i) {
+        EXPECT_EQ(results_host(i), neutral + count * (count - 1) / 2);
+    }
+}
+
+void TestTeamScanTwoDimensions()
+{
+    DDomXY const dom(lbound_x_y, nelems_x_y);
+    ddc::Chunk chunk(dom, ddc::DeviceAllocator<int>());
+    ddc::ChunkSpan const chunk_span = chunk.span_view();
+    Kokkos::View<int> const total("total");
+    Kokkos::parallel_for(
+            Kokkos::TeamPolicy<>(1, Kokkos::AUTO),
+            KOKKOS_LAMBDA(Kokkos::TeamPolicy<>::member_type const& team) {
+                int result = 0;
+                ddc::team_scan(
+                        team,
+                        dom,
+                        [&](DElemXY const i, int& partial_sum, bool const is_final) {
+                            if (is_final) {
+                                chunk_span(i) = partial_sum;
+                            }
+                            partial_sum += 1;
+                        },
+                        result);
+                Kokkos::single(Kokkos::PerTeam(team), [&]() { total() = result; });
+            });
+    auto const chunk_host = ddc::create_mirror_view_and_copy(chunk_span);
+    int count = 0;
+    ddc::host_for_each(dom, [&](DElemXY const i) { EXPECT_EQ(chunk_host(i), count++); });
+    auto const total_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), total);
+    EXPECT_EQ(total_host(), dom.size());
+}
+
+} // namespace anonymous_namespace_workaround_team_algorithms_cpp
+
+TEST(TeamForEach, ZeroDimension)
+{
+    TestTeamForEach(DDom0D());
+}
+
+TEST(TeamForEach, OneDimension)
+{
+    TestTeamForEach(DDomX(lbound_x, nelems_x));
+}
+
+TEST(TeamForEach, TwoDimensions)
+{
+    TestTeamForEach(DDomXY(lbound_x_y, nelems_x_y));
+}
+
+TEST(TeamTransformReduce, ZeroDimension)
+{
+    TestTeamTransformReduce(DDom0D());
+}
+
+TEST(TeamTransformReduce, OneDimension)
+{
+    TestTeamTransformReduce(DDomX(lbound_x, nelems_x));
+}
+
+TEST(TeamTransformReduce, TwoDimensions)
+{
+    TestTeamTransformReduce(DDomXY(lbound_x_y, nelems_x_y));
+}
+
+TEST(TeamTransformReduce, NonIdentityNeutral)
+{
+    TestTeamTransformReduce(DDom0D(), 7);
+    TestTeamTransformReduce(DDomX(lbound_x, nelems_x), 7);
+    TestTeamTransformReduce(DDomXY(lbound_x_y, nelems_x_y), 7);
+}
+
+TEST(TeamScan, TwoDimensions)
+{
+    TestTeamScanTwoDimensions();
+}
@@ -81,6 +81,67 @@ TEST(TransformReduce, TwoDimensions)
             dom.size() * (dom.size() - 1) / 2);
 }
 
+TEST(TransformReduceParallelHost, ZeroDimension)
+{
+    DDom0D const dom;
+    int storage = 3;
+    ddc::ChunkSpan<int, DDom0D> const chunk(&storage, dom);
+    EXPECT_EQ(
+            ddc::host_transform_reduce(
+                    Kokkos::DefaultHostExecutionSpace(),
+                    dom,
+                    0,
+                    ddc::reducer::sum<int>(),
+                    chunk),
+            3);
+}
+
+TEST(TransformReduceParallelHost, TwoDimensions)
+{
+    // Large enough to be split in several blocks
+    DDomXY const dom(lbound_x_y, DVectXY(1000, 97));
+    std::vector<int> storage(dom.size(), 0);
+    ddc::ChunkSpan<int, DDomXY> const chunk(storage.data(), dom);
+    int count = 0;
+    ddc::host_for_each(dom, [&](DElemXY const ixy) { chunk(ixy) = count++; });
+    EXPECT_EQ(
+            ddc::host_transform_reduce(
+                    Kokkos::DefaultHostExecutionSpace(),
+                    dom,
+                    0L,
+                    ddc::reducer::sum<long>(),
+                    [&](DElemXY const ixy) { return static_cast<long>(chunk(ixy)); }),
+            static_cast<long>(dom.size() * (dom.size() - 1) / 2));
+}
+
+TEST(TransformReduceParallelHost, Deterministic)
+{
+    DDomXY const dom(lbound_x_y, DVectXY(1000, 97));
+    auto const transform = [&](DElemXY const ixy) {
+        return 1. / static_cast<double>(1 + (ixy - lbound_x_y).get<DDimX>())
+               - 1. / static_cast<double>(1 + (ixy - lbound_x_y).get<DDimY>());
+    };
+    double const sum_ref = ddc::host_transform_reduce(
+            Kokkos::DefaultHostExecutionSpace(),
+            dom,
+            0.,
+            ddc::reducer::sum<double>(),
+            transform);
+    for (int i = 0; i < 10; ++i) {
+        double const sum = ddc::host_transform_reduce(
+                Kokkos::DefaultHostExecutionSpace(),
+                dom,
+                0.,
+                ddc::reducer::sum<double>(),
+                transform);
+        EXPECT_EQ(sum, sum_ref);
+    }
+    EXPECT_NEAR(
+            sum_ref,
+            ddc::host_transform_reduce(dom, 0., ddc::reducer::sum<double>(), transform),
+            1e-9);
+}
+
 int TestDeviceTransformReduce(
         ddc::ChunkSpan<
                 int,